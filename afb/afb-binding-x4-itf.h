@@ -36,7 +36,7 @@
  * is compiled with the full structure definition. Then when libafb
  * is widely spread on equiment, bindings can be compiled with newer features.
  */
-#define AFB_BINDING_X4R1_ITF_FULL_REVISION     9
+#define AFB_BINDING_X4R1_ITF_FULL_REVISION    10
 #define AFB_BINDING_X4R1_ITF_CURRENT_REVISION  7
 
 /*
@@ -79,6 +79,8 @@ struct afb_type_x4;
 struct afb_data_x4;
 struct afb_evfd_x4;
 struct afb_timer_x4;
+struct afb_data_pool_x4;
+struct afb_type_conversion_x4;
 
 typedef struct afb_api_x4        *afb_api_x4_t;
 typedef struct afb_req_x4        *afb_req_x4_t;
@@ -87,6 +89,11 @@ typedef struct afb_data_x4       *afb_data_x4_t;
 typedef struct afb_type_x4       *afb_type_x4_t;
 typedef struct afb_evfd_x4       *afb_evfd_x4_t;
 typedef struct afb_timer_x4      *afb_timer_x4_t;
+typedef struct afb_data_pool_x4  *afb_data_pool_x4_t;
+typedef struct afb_type_conversion_x4 *afb_type_conversion_x4_t;
+
+/** identifiers of types: FNV-1a 64 bits hash of their names */
+typedef uint64_t afb_type_id_x4_t;
 
 /******************************************************************************/
 
@@ -106,6 +113,63 @@ typedef
 
 /******************************************************************************/
 
+/**
+ * Kinds of the values located in JSON views
+ */
+typedef
+	enum afb_json_kind_x4
+{
+	/** the value null */
+	Afb_Json_Kind_x4_Null = 0,
+
+	/** the values true or false */
+	Afb_Json_Kind_x4_Boolean = 1,
+
+	/** a number */
+	Afb_Json_Kind_x4_Number = 2,
+
+	/** a string */
+	Afb_Json_Kind_x4_String = 3,
+
+	/** an array */
+	Afb_Json_Kind_x4_Array = 4,
+
+	/** an object */
+	Afb_Json_Kind_x4_Object = 5
+}
+	afb_json_kind_x4_t;
+
+/**
+ * Kinds of the fields of records
+ */
+typedef
+	enum afb_record_kind_x4
+{
+	/** boolean stored in a char */
+	Afb_Record_Kind_x4_Bool = 1,
+
+	/** signed 32 bit integer */
+	Afb_Record_Kind_x4_I32 = 2,
+
+	/** unsigned 32 bit integer */
+	Afb_Record_Kind_x4_U32 = 3,
+
+	/** signed 64 bit integer */
+	Afb_Record_Kind_x4_I64 = 4,
+
+	/** unsigned 64 bit integer */
+	Afb_Record_Kind_x4_U64 = 5,
+
+	/** double */
+	Afb_Record_Kind_x4_Double = 6,
+
+	/** zero terminated string stored in an array of char */
+	Afb_Record_Kind_x4_String = 7
+}
+	afb_record_kind_x4_t;
+
+/******************************************************************************/
+
 /**
  * Main api callback function.
  *
@@ -261,6 +325,156 @@ typedef void (*afb_evfd_handler_x4_t)(afb_evfd_x4_t efd, int fd, uint32_t revent
  */
 typedef void (*afb_timer_handler_x4_t)(afb_timer_x4_t timer, void *closure, unsigned decount);
 
+/**
+ * Callbacks of data watchers
+ *
+ * These callbacks are called after a watched data changed, by the
+ * thread that notified the change.
+ *
+ * @param closure the closure given when watching
+ * @param data the data that changed
+ */
+typedef void (*afb_data_watcher_x4_t)(void *closure, afb_data_x4_t data);
+
+/******************************************************************************/
+
+/**
+ * Description of one data to be created by the function create_data_array.
+ * The fields have the meaning of the parameters of create_data_raw.
+ */
+struct afb_data_desc_x4
+{
+	/** type of the data */
+	afb_type_x4_t type;
+
+	/** pointer of the data, can be NULL */
+	const void *pointer;
+
+	/** size of the data */
+	size_t size;
+
+	/** callback for releasing resources, can be NULL */
+	void (*dispose)(void*);
+
+	/** closure of the callback dispose */
+	void *closure;
+};
+
+/**
+ * Description of one segment of a scatter/gather data (type iovec).
+ * The memory of the segment is released using its dispose callback
+ * when the data is released.
+ */
+struct afb_iovec_x4
+{
+	/** base address of the segment */
+	const void *base;
+
+	/** length of the segment */
+	size_t length;
+
+	/** callback for releasing the segment, can be NULL */
+	void (*dispose)(void*);
+
+	/** closure of the callback dispose */
+	void *closure;
+};
+
+/**
+ * Counters of a data pool, intended for tuning its size classes.
+ */
+struct afb_data_pool_stats_x4
+{
+	/** count of allocations served by the pool */
+	uint64_t hits;
+
+	/** count of allocations not served by the pool */
+	uint64_t misses;
+
+	/** count of blocks of the pool currently used by data */
+	uint64_t used;
+
+	/** count of blocks of the pool currently cached for reuse */
+	uint64_t cached;
+};
+
+/**
+ * Counters of the dependencies of a data, intended for debugging.
+ */
+struct afb_data_dependency_stats_x4
+{
+	/** count of data the data directly depends on */
+	uint64_t direct;
+
+	/** count of distinct data the data depends on, directly or not */
+	uint64_t total;
+
+	/** sum of the sizes of the distinct data the data depends on */
+	uint64_t retained_bytes;
+
+	/** length of the longest chain of dependencies */
+	uint64_t depth;
+};
+
+/**
+ * Location of a value in the text of a JSON view.
+ */
+struct afb_json_token_x4
+{
+	/** kind of the value */
+	afb_json_kind_x4_t kind;
+
+	/** count of items of arrays or of members of objects, 0 otherwise */
+	unsigned count;
+
+	/** offset of the value in the text, after the quote for strings */
+	size_t offset;
+
+	/** length of the value in the text, without quotes for strings */
+	size_t length;
+};
+
+/**
+ * Description of one field of a record type.
+ */
+struct afb_record_field_x4
+{
+	/** name of the field, key of its value in JSON */
+	const char *name;
+
+	/** kind of the field */
+	afb_record_kind_x4_t kind;
+
+	/** offset of the field in the record */
+	size_t offset;
+
+	/** size of the field in the record */
+	size_t size;
+};
+
+/**
+ * Parameters of the FNV-1a 64 bits hash computing identifiers of types
+ */
+#define AFB_TYPE_ID_X4_OFFSET_BASIS  ((afb_type_id_x4_t)14695981039346656037ULL)
+#define AFB_TYPE_ID_X4_PRIME         ((afb_type_id_x4_t)1099511628211ULL)
+
+/**
+ * Cost of the converters added without explicit cost
+ */
+#define AFB_TYPE_CONVERTER_X4_DEFAULT_COST  100
+
+/**
+ * Maximum size of values stored inside the data object
+ * by the function create_data_inline.
+ */
+#define AFB_DATA_X4_INLINE_SIZE_MAX  32
+
+/**
+ * Sequence returned by data_read_begin for constant data.
+ * Sequences of data that are not constant are always even.
+ */
+#define AFB_DATA_X4_SEQUENCE_CONSTANT  ((uint64_t)1)
+
 /******************************************************************************/
 
 /**
@@ -930,6 +1144,200 @@ struct afb_binding_x4r1_itf
 
 #endif
 
+/*-- BEGIN OF VERSION 4r1  REVISION 10 (first version 4.4.0) -------------------*/
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+
+	/** create an array of new data from raw values */
+	int (*create_data_array)(
+		unsigned count,
+		afb_data_x4_t data[],
+		const struct afb_data_desc_x4 descs[]);
+
+	/** increment of reference count of the data of an array */
+	void (*data_array_addref)(
+		unsigned count,
+		afb_data_x4_t const array[]);
+
+	/** decrement of reference count of the data of an array */
+	void (*data_array_unref)(
+		unsigned count,
+		afb_data_x4_t const array[]);
+
+	/** get the data of an array converted to the given types (return new references) */
+	int (*data_array_convert)(
+		unsigned count,
+		afb_data_x4_t const array_data[],
+		afb_type_x4_t const array_type[],
+		afb_data_x4_t array_result[]);
+
+	/** predefined type iovec (scatter/gather) */
+	afb_type_x4_t type_iovec;
+
+	/** create a new data of type iovec from its segments */
+	int (*create_data_iovec)(
+		afb_data_x4_t *data,
+		unsigned count,
+		const struct afb_iovec_x4 iovec[]);
+
+	/** create a new data mapping the content of a file */
+	int (*create_data_mmap)(
+		afb_data_x4_t *data,
+		afb_type_x4_t type,
+		int fd,
+		int64_t offset,
+		size_t length);
+
+	/** create a pool of memory for data */
+	int (*api_data_pool_create)(
+		afb_api_x4_t api,
+		afb_data_pool_x4_t *pool,
+		unsigned nclasses,
+		const size_t sizes[],
+		unsigned thread_cache);
+
+	/** addref the data pool */
+	afb_data_pool_x4_t (*data_pool_addref)(
+		afb_data_pool_x4_t pool);
+
+	/** unref the data pool */
+	void (*data_pool_unref)(
+		afb_data_pool_x4_t pool);
+
+	/** get the counters of the data pool */
+	void (*data_pool_stats)(
+		afb_data_pool_x4_t pool,
+		struct afb_data_pool_stats_x4 *stats);
+
+	/** create a new data allocated in the data pool */
+	int (*create_data_alloc_pooled)(
+		afb_data_x4_t *data,
+		afb_type_x4_t type,
+		void **pointer,
+		size_t size,
+		afb_data_pool_x4_t pool);
+
+	/** create a new data by copying the value inside the data if small enough */
+	int (*create_data_inline)(
+		afb_data_x4_t *data,
+		afb_type_x4_t type,
+		const void *pointer,
+		size_t size);
+
+	/** get the data converted to the given type and cached (return a borrowed reference) */
+	int (*data_convert_cached)(
+		afb_data_x4_t data,
+		afb_type_x4_t type,
+		afb_data_x4_t *result);
+
+	/** get the conversion from a type to an other type */
+	int (*type_get_converter)(
+		afb_type_x4_t from_type,
+		afb_type_x4_t to_type,
+		afb_type_conversion_x4_t *conversion);
+
+	/** convert the data using the conversion (return a new reference) */
+	int (*data_convert_with)(
+		afb_type_conversion_x4_t conversion,
+		afb_data_x4_t data,
+		afb_data_x4_t *result);
+
+	/** begin an optimistic read of the data, return its sequence */
+	uint64_t (*data_read_begin)(
+		afb_data_x4_t data);
+
+	/** check if the data was written since the given sequence */
+	int (*data_read_retry)(
+		afb_data_x4_t data,
+		uint64_t sequence);
+
+	/** get a mutable pointer to the data, copying it if shared */
+	int (*data_get_mutable_cow)(
+		afb_data_x4_t *data,
+		void **pointer,
+		size_t *size);
+
+	/** get the counters of the dependencies of the data */
+	int (*data_dependency_stats)(
+		afb_data_x4_t data,
+		struct afb_data_dependency_stats_x4 *stats);
+
+	/** call the callback for each data the data directly depends on */
+	int (*data_dependency_foreach)(
+		afb_data_x4_t data,
+		int (*callback)(void *closure, afb_data_x4_t dependency),
+		void *closure);
+
+	/** add a watcher of the changes of the data */
+	int (*data_watch)(
+		afb_data_x4_t data,
+		afb_data_watcher_x4_t watcher,
+		void *closure);
+
+	/** remove a watcher of the changes of the data */
+	int (*data_unwatch)(
+		afb_data_x4_t data,
+		afb_data_watcher_x4_t watcher,
+		void *closure);
+
+	/** predefined type json view (json string with index) */
+	afb_type_x4_t type_json_view;
+
+	/** locate in the json view the value of the json pointer */
+	int (*json_view_lookup)(
+		afb_data_x4_t data,
+		const char *pointer,
+		struct afb_json_token_x4 *token);
+
+	/** register a type of records with converters to and from json-c */
+	int (*type_register_record)(
+		afb_type_x4_t *type,
+		const char *name,
+		size_t size,
+		unsigned nfields,
+		const struct afb_record_field_x4 fields[]);
+
+	/** lookup for the type of the given identifier */
+	int (*type_lookup_id)(
+		afb_type_x4_t *type,
+		afb_type_id_x4_t id);
+
+	/** get the family of a type */
+	afb_type_x4_t (*type_get_family)(
+		afb_type_x4_t type
+		);
+
+	/** add converter with its cost */
+	int (*type_add_converter_cost)(
+		afb_type_x4_t fromtype,
+		afb_type_x4_t totype,
+		afb_type_converter_x4_t converter,
+		void *closure,
+		unsigned cost);
+
+	/** get the cost of the cheapest conversion between types */
+	int (*type_conversion_cost)(
+		afb_type_x4_t fromtype,
+		afb_type_x4_t totype,
+		unsigned *cost,
+		unsigned *hops);
+
+	/** predefined type array of int32_t */
+	afb_type_x4_t type_i32_array;
+
+	/** predefined type array of uint32_t */
+	afb_type_x4_t type_u32_array;
+
+	/** predefined type array of int64_t */
+	afb_type_x4_t type_i64_array;
+
+	/** predefined type array of float */
+	afb_type_x4_t type_f32_array;
+
+	/** predefined type array of double */
+	afb_type_x4_t type_f64_array;
+
+#endif
+
 /*-- END OF VERSION 4r1 -----------------------------------*/
 };
 
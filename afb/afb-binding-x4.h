@@ -22,8 +22,20 @@ typedef afb_data_x4_t    afb_data_t;
 typedef afb_type_x4_t    afb_type_t;
 typedef afb_evfd_x4_t    afb_evfd_t;
 typedef afb_timer_x4_t   afb_timer_t;
+typedef afb_data_pool_x4_t afb_data_pool_t;
+typedef afb_type_conversion_x4_t afb_type_conversion_t;
+typedef afb_type_id_x4_t   afb_type_id_t;
+
+typedef struct afb_data_desc_x4 afb_data_desc_t;
+typedef struct afb_iovec_x4     afb_iovec_t;
+typedef struct afb_data_pool_stats_x4 afb_data_pool_stats_t;
+typedef struct afb_data_dependency_stats_x4 afb_data_dependency_stats_t;
+typedef struct afb_json_token_x4 afb_json_token_t;
+typedef struct afb_record_field_x4 afb_record_field_t;
 
 typedef afb_type_flags_x4_t     afb_type_flags_t;
+typedef afb_json_kind_x4_t      afb_json_kind_t;
+typedef afb_record_kind_x4_t    afb_record_kind_t;
 typedef afb_type_converter_x4_t afb_type_converter_t;
 typedef afb_type_updater_x4_t   afb_type_updater_t;
 
@@ -37,6 +49,7 @@ typedef afb_type_converter_x4_t   afb_type_converter_t;
 typedef afb_type_updater_x4_t     afb_type_updater_t;
 typedef afb_evfd_handler_x4_t     afb_evfd_handler_t;
 typedef afb_timer_handler_x4_t    afb_timer_handler_t;
+typedef afb_data_watcher_x4_t     afb_data_watcher_t;
 
 /** constants ***********************************************************/
 
@@ -44,6 +57,32 @@ typedef afb_timer_handler_x4_t    afb_timer_handler_t;
 #define Afb_Type_Flags_Streamable	Afb_Type_Flags_x4_Streamable
 #define Afb_Type_Flags_Opaque		Afb_Type_Flags_x4_Opaque
 
+#define Afb_Json_Kind_Null		Afb_Json_Kind_x4_Null
+#define Afb_Json_Kind_Boolean		Afb_Json_Kind_x4_Boolean
+#define Afb_Json_Kind_Number		Afb_Json_Kind_x4_Number
+#define Afb_Json_Kind_String		Afb_Json_Kind_x4_String
+#define Afb_Json_Kind_Array		Afb_Json_Kind_x4_Array
+#define Afb_Json_Kind_Object		Afb_Json_Kind_x4_Object
+
+#define Afb_Record_Kind_Bool		Afb_Record_Kind_x4_Bool
+#define Afb_Record_Kind_I32		Afb_Record_Kind_x4_I32
+#define Afb_Record_Kind_U32		Afb_Record_Kind_x4_U32
+#define Afb_Record_Kind_I64		Afb_Record_Kind_x4_I64
+#define Afb_Record_Kind_U64		Afb_Record_Kind_x4_U64
+#define Afb_Record_Kind_Double		Afb_Record_Kind_x4_Double
+#define Afb_Record_Kind_String		Afb_Record_Kind_x4_String
+
+/**
+ * Initializer of the description of the field @p member of the
+ * structure @p rectype, of kind @p kind (one of Afb_Record_Kind_...)
+ */
+#define AFB_RECORD_FIELD(rectype,member,kind) \
+	{ #member, kind, offsetof(rectype, member), sizeof(((rectype*)0)->member) }
+
+#define AFB_DATA_INLINE_SIZE_MAX	AFB_DATA_X4_INLINE_SIZE_MAX
+#define AFB_DATA_SEQUENCE_CONSTANT	AFB_DATA_X4_SEQUENCE_CONSTANT
+#define AFB_TYPE_CONVERTER_DEFAULT_COST	AFB_TYPE_CONVERTER_X4_DEFAULT_COST
+
 /******************************************************************************/
 
 #if !defined(AFB_BINDING_NO_ROOT) /* use with caution, see @ref validity-v4 */
@@ -192,6 +231,344 @@ afb_create_data_copy(
 	return afbBindingV4r1_itfptr->create_data_copy(data, type, buffer, size);
 }
 
+/**
+ * Creates 'count' new data instances in one call. The data of index i
+ * is created from the values given by the descriptor 'descs[i]', as
+ * does the function @see afb_create_data_raw.
+ *
+ * The creation is done all or nothing. In case of error, no data is created,
+ * the items of 'data' are set to NULL and the dispose functions of the
+ * descriptors, when defined, are called to release the wrapped data.
+ *
+ * This function is equivalent to (except that it is done at once):
+ *
+ *    for (i = 0 ; i < count ; i++)
+ *        afb_create_data_raw(&data[i], descs[i].type, descs[i].pointer,
+ *                  descs[i].size, descs[i].dispose, descs[i].closure);
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param count    count of data to create
+ * @param data     array receiving the created data
+ * @param descs    array of the descriptions of the data to create
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_array(
+	unsigned count,
+	afb_data_t data[],
+	const afb_data_desc_t descs[]
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->create_data_array(count, data, descs);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Creates a new data instance of the given type by copying the memory
+ * given by pointer and size. When the size is not greater than
+ * @ref AFB_DATA_INLINE_SIZE_MAX, the copy is stored inside the data
+ * object itself, avoiding an allocation. Otherwise, it is equivalent
+ * to @ref afb_create_data_copy.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data     pointer to the created data
+ * @param type     type of the data to created
+ * @param pointer  pointer of the value to copy
+ * @param size     size of the value to copy
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_inline(
+	afb_data_t *data,
+	afb_type_t type,
+	const void *pointer,
+	size_t size
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->create_data_inline(data, type, pointer, size);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Creates a new data of type @ref AFB_PREDEFINED_TYPE_BOOL holding
+ * the boolean 'value' (0 or 1).
+ * The value is stored inside the data.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data     pointer to the created data
+ * @param value    the value of the data
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_bool(
+	afb_data_t *data,
+	int value
+) {
+	char val = (value != 0);
+	return afb_create_data_inline(data, afbBindingV4r1_itfptr->type_bool, &val, sizeof val);
+}
+
+/**
+ * Creates a new data of type @ref AFB_PREDEFINED_TYPE_I32 holding
+ * the signed 32 bits integer 'value'.
+ * The value is stored inside the data.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data     pointer to the created data
+ * @param value    the value of the data
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_i32(
+	afb_data_t *data,
+	int32_t value
+) {
+	return afb_create_data_inline(data, afbBindingV4r1_itfptr->type_i32, &value, sizeof value);
+}
+
+/**
+ * Creates a new data of type @ref AFB_PREDEFINED_TYPE_U32 holding
+ * the unsigned 32 bits integer 'value'.
+ * The value is stored inside the data.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data     pointer to the created data
+ * @param value    the value of the data
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_u32(
+	afb_data_t *data,
+	uint32_t value
+) {
+	return afb_create_data_inline(data, afbBindingV4r1_itfptr->type_u32, &value, sizeof value);
+}
+
+/**
+ * Creates a new data of type @ref AFB_PREDEFINED_TYPE_I64 holding
+ * the signed 64 bits integer 'value'.
+ * The value is stored inside the data.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data     pointer to the created data
+ * @param value    the value of the data
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_i64(
+	afb_data_t *data,
+	int64_t value
+) {
+	return afb_create_data_inline(data, afbBindingV4r1_itfptr->type_i64, &value, sizeof value);
+}
+
+/**
+ * Creates a new data of type @ref AFB_PREDEFINED_TYPE_U64 holding
+ * the unsigned 64 bits integer 'value'.
+ * The value is stored inside the data.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data     pointer to the created data
+ * @param value    the value of the data
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_u64(
+	afb_data_t *data,
+	uint64_t value
+) {
+	return afb_create_data_inline(data, afbBindingV4r1_itfptr->type_u64, &value, sizeof value);
+}
+
+/**
+ * Creates a new data of type @ref AFB_PREDEFINED_TYPE_DOUBLE holding
+ * the double 'value'.
+ * The value is stored inside the data.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data     pointer to the created data
+ * @param value    the value of the data
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_double(
+	afb_data_t *data,
+	double value
+) {
+	return afb_create_data_inline(data, afbBindingV4r1_itfptr->type_double, &value, sizeof value);
+}
+
+/**
+ * Creates a new data of type @ref AFB_PREDEFINED_TYPE_STRINGZ holding
+ * a copy of the 'string'. The copy is stored inside the data when
+ * the string is short enough (see @ref afb_create_data_inline).
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data     pointer to the created data
+ * @param string   the string to copy (can be NULL)
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_stringz(
+	afb_data_t *data,
+	const char *string
+) {
+	size_t size = 0;
+
+	if (string != NULL)
+		while (string[size++] != 0);
+	return afb_create_data_inline(data, afbBindingV4r1_itfptr->type_stringz, string, size);
+}
+
+/**
+ * Creates a new data instance of the given type whose content is
+ * the region of the file 'fd' mapped in memory (see mmap).
+ *
+ * The region is mapped for reading and the created data is constant.
+ * Its memory is unmapped when the data is released. Because the mapping
+ * remains valid after closing the file, the file descriptor 'fd' can be
+ * closed as soon as the function returns.
+ *
+ * The memory of the file is not copied, it is directly used by replies
+ * and conversions. This is intended for big files that are not modified
+ * while they are mapped.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data     pointer to the created data
+ * @param type     type of the data to created
+ * @param fd       the file descriptor of the file to map
+ * @param offset   offset of the region in the file
+ * @param length   length of the region or zero for the end of the file
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_mmap(
+	afb_data_t *data,
+	afb_type_t type,
+	int fd,
+	int64_t offset,
+	size_t length
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->create_data_mmap(data, type, fd, offset, length);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Creates a new data of the predefined type @ref AFB_PREDEFINED_TYPE_IOVEC
+ * that gathers the 'count' segments of 'iovec' without copying them.
+ *
+ * The descriptions of the segments are copied but not the memory
+ * of the segments. When the data is released, the dispose function
+ * of each segment, when defined, is called with its closure.
+ *
+ * In case of error, the dispose functions of the segments, when
+ * defined, are called to release the segments.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data     pointer to the created data
+ * @param count    count of segments
+ * @param iovec    array of the descriptions of the segments
+ *
+ * @return 0 in case of success or negative value in case of error.
+ *
+ * @see afb_data_get_iovec
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_iovec(
+	afb_data_t *data,
+	unsigned count,
+	const afb_iovec_t iovec[]
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->create_data_iovec(data, count, iovec);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
 /**
  * Increases the count of references of 'data'
  *
@@ -247,6 +624,89 @@ afb_data_convert(
 	return afbBindingV4r1_itfptr->data_convert(data, type, result);
 }
 
+/**
+ * Gets the 'data' converted to the 'type' and remembered by the data.
+ *
+ * The first call for a given type converts the data and keeps the
+ * result attached to the data. Later calls for the same type return
+ * that result without converting again, until the data is notified as
+ * changed using afb_data_notify_changed.
+ *
+ * The returned data is borrowed: it MUST NOT be released using
+ * afb_data_unref. It remains valid as long as the original data is
+ * valid and not changed. Use afb_data_addref to keep it longer.
+ *
+ * Volatile data are never cached: the function fails for them
+ * and afb_data_convert must be used instead.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data   the original data
+ * @param type   the expected type
+ * @param result location for storing the borrowed result of the conversion
+ *
+ * @return 0 in case of success or a negative value indication the error.
+ *
+ * @see afb_data_convert
+ * @see afb_data_notify_changed
+ * @see afb_data_is_volatile
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_data_convert_cached(
+	afb_data_t data,
+	afb_type_t type,
+	afb_data_t *result
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->data_convert_cached(data, type, result);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Converts the 'data' using the 'conversion' previously got
+ * using afb_type_get_converter.
+ *
+ * The type of the data must be the type 'from_type' given to
+ * afb_type_get_converter. No search of converters is done.
+ *
+ * If a data is returned (no error case), it MUST be released
+ * using afb_data_unref.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param conversion the conversion to apply
+ * @param data       the original data
+ * @param result     location for storing the result of the conversion
+ *
+ * @return 0 in case of success or a negative value indication the error.
+ *
+ * @see afb_type_get_converter
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_data_convert_with(
+	afb_type_conversion_t conversion,
+	afb_data_t data,
+	afb_data_t *result
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->data_convert_with(conversion, data, result);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
 /**
  * Gets the type of the data.
  *
@@ -285,6 +745,48 @@ afb_data_get_mutable(
 	return afbBindingV4r1_itfptr->data_get_mutable(data, pointer, size);
 }
 
+/**
+ * Gets a mutable pointer to the data and also its size, copying
+ * the data if needed.
+ *
+ * When the caller holds the only reference of the data and the
+ * data is not constant, the value is given in place as with
+ * afb_data_get_mutable. Otherwise, the value is copied in a new data
+ * of the same type that replaces the data in '*data', the reference
+ * of the caller to the original data being released.
+ *
+ * Getting a mutable pointer has the effect of automatically
+ * notifying that the data changed (is changing).
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data pointer to the data, possibly replaced by a copy
+ * @param pointer if not NULL address where to store the pointer
+ * @param size if not NULL address where to store the size
+ *
+ * @return 0 in case of success or a negative value indication the error,
+ *         in that case, '*data' is not changed
+ *
+ * @see afb_data_get_mutable
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_data_get_mutable_cow(
+	afb_data_t *data,
+	void **pointer,
+	size_t *size
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->data_get_mutable_cow(data, pointer, size);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
 /**
  * Gets a pointer to the data for read only usage.
  * The returned pointer isn't tagged as const
@@ -376,6 +878,82 @@ afb_data_notify_changed(
 	afbBindingV4r1_itfptr->data_notify_changed(data);
 }
 
+/**
+ * Watches the changes of the data: the @p watcher is called with
+ * the @p closure each time the data changed, i.e. after the call to
+ * afb_data_notify_changed or afb_data_update and when the data is
+ * unlocked after being locked for write.
+ * This avoids polling for changes of data shared by many clients.
+ *
+ * Note that afb_data_get_mutable notifies the change when it gives
+ * the pointer, before the caller writes: watchers called at that time
+ * see the previous value. So after writing through that pointer,
+ * call afb_data_notify_changed for the watchers to see the new value.
+ *
+ * The watcher is called by the thread that changed the data. It
+ * holds no reference on the data: it is removed when the data is
+ * released.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data the data to watch
+ * @param watcher the function to call on changes
+ * @param closure the closure of the watcher
+ *
+ * @return 0 in case of success or a negative value indication the error.
+ *
+ * @see afb_data_unwatch
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_data_watch(
+	afb_data_t data,
+	afb_data_watcher_t watcher,
+	void *closure
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->data_watch(data, watcher, closure);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Stops watching the changes of the data. The @p watcher and @p closure
+ * must be the ones given to afb_data_watch.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data the watched data
+ * @param watcher the function called on changes
+ * @param closure the closure of the watcher
+ *
+ * @return 0 in case of success or a negative value indication the error.
+ *
+ * @see afb_data_watch
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_data_unwatch(
+	afb_data_t data,
+	afb_data_watcher_t watcher,
+	void *closure
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->data_unwatch(data, watcher, closure);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
 /**
  * Tests if the data is volatile. Conversions of volatile data are never cached.
  *
@@ -544,6 +1122,78 @@ afb_data_unlock(
 	afbBindingV4r1_itfptr->data_unlock(data);
 }
 
+/**
+ * Begins a read of the data without locking it. It is intended for
+ * data read by many threads and seldom written. The read must be
+ * checked using afb_data_read_retry and done again until it succeeds:
+ *
+ *     uint64_t seq;
+ *     do {
+ *         seq = afb_data_read_begin(data);
+ *         ... read the value ...
+ *     } while (afb_data_read_retry(data, seq));
+ *
+ * Writers lock the data for write with afb_data_lock_write. If the data
+ * is currently locked for write, the function waits until it is unlocked.
+ *
+ * For constant data, the function returns @ref AFB_DATA_SEQUENCE_CONSTANT
+ * and afb_data_read_retry then returns 0 inline, without calling
+ * the binder.
+ *
+ * The read value may be inconsistent until checked: it must not be used
+ * to follow pointers or index arrays before afb_data_read_retry succeeded.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data the data to read
+ *
+ * @return the sequence to give to afb_data_read_retry
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+uint64_t
+afb_data_read_begin(
+	afb_data_t data
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->data_read_begin(data);
+#else
+	return AFB_DATA_SEQUENCE_CONSTANT;
+#endif
+}
+
+/**
+ * Checks whether the read begun with afb_data_read_begin has to be
+ * done again because the data was written meanwhile.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data the data read
+ * @param sequence the sequence returned by afb_data_read_begin
+ *
+ * @return 0 if the read is consistent or 1 if it has to be done again
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_data_read_retry(
+	afb_data_t data,
+	uint64_t sequence
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return sequence != AFB_DATA_SEQUENCE_CONSTANT
+		&& afbBindingV4r1_itfptr->data_read_retry(data, sequence);
+#else
+	return 0;
+#endif
+}
+
 /**
  * Update the value of the given data with the given value
  *
@@ -561,6 +1211,49 @@ afb_data_update(
 	return afbBindingV4r1_itfptr->data_update(data, value);
 }
 
+/**
+ * Converts the data @p from into the existing data @p to, reusing it:
+ * the value of @p to is updated in place, so a publisher can keep one
+ * output data per type and refresh it at each cycle.
+ *
+ * The update is first tried with afb_data_update. When it fails, @p from
+ * is converted to the type of @p to using afb_data_convert and @p to
+ * is updated with the converted value.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param from the data of reference
+ * @param to the data to update, must be mutable
+ *
+ * @return 0 on success or a negative -errno like value
+ *
+ * @see afb_data_update
+ * @see afb_data_convert
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_data_convert_into(
+	afb_data_t from,
+	afb_data_t to
+) {
+	int rc;
+	afb_data_t tmp;
+
+	rc = afb_data_update(to, from);
+	if (rc < 0) {
+		rc = afb_data_convert(from, afb_data_type(to), &tmp);
+		if (rc >= 0) {
+			rc = afb_data_update(to, tmp);
+			afb_data_unref(tmp);
+		}
+	}
+	return rc;
+}
+
 /**
  * Replace 'data' with the given 'value', taking care to unreference
  * the assigned data. But, caution, it does not increment the reference
@@ -634,6 +1327,153 @@ afb_data_dependency_drop_all(
 	return afbBindingV4r1_itfptr->data_dependency_drop_all(data);
 }
 
+/**
+ * Gets the pointer of the data for reading it as an instance of the
+ * @p family, without conversion. It succeeds when the type of the data
+ * is of the family, see @ref afb_type_is_of_family. No data is
+ * created and no reference is taken: the pointer is valid as long
+ * as the data is.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data the data
+ * @param family the expected family
+ * @param pointer where to store the read only pointer of the data
+ *
+ * @return 0 in case of success or AFB_ERRNO_INVALID_REQUEST
+ *         if the type of the data is not of the family
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_data_as_family(
+	afb_data_t data,
+	afb_type_t family,
+	const void **pointer
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	afb_type_t type = afb_data_type(data);
+	while (type != family) {
+		if (type == NULL)
+			return AFB_ERRNO_INVALID_REQUEST;
+		type = afbBindingV4r1_itfptr->type_get_family(type);
+	}
+	*pointer = afb_data_ro_pointer(data);
+	return 0;
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Gets the counters of the dependencies of the @p data, i.e. the data
+ * it depends on, directly or through other data. Each data is counted
+ * once even if reached many times.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data the data whose dependencies are inspected
+ * @param stats where to store the counters
+ *
+ * @return 0 in case of success or a negative number
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_data_dependency_stats(
+	afb_data_t data,
+	afb_data_dependency_stats_t *stats
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->data_dependency_stats(data, stats);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Calls the @p callback for each data the @p data directly depends on,
+ * until the callback returns a value not null.
+ *
+ * The callback receives the @p closure and the data. It must not change
+ * the dependencies of @p data. No reference is given to it: the data
+ * must be referenced using afb_data_addref for being kept.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data the data whose dependencies are enumerated
+ * @param callback the function to call
+ * @param closure the closure of the callback
+ *
+ * @return 0 if all dependencies were enumerated, the not null value
+ *         returned by the callback that stopped the enumeration or
+ *         a negative number on error
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_data_dependency_foreach(
+	afb_data_t data,
+	int (*callback)(void *closure, afb_data_t dependency),
+	void *closure
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->data_dependency_foreach(data, callback, closure);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Gets the segments of a data of type @ref AFB_PREDEFINED_TYPE_IOVEC
+ *
+ * The returned segments are read only and remain valid as long as
+ * the data is referenced.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data   the data of type iovec
+ * @param iovec  where to store the address of the array of segments
+ *
+ * @return the count of segments or a negative error code, in particular
+ *         AFB_ERRNO_INVALID_REQUEST if the data is not of type iovec
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_data_get_iovec(
+	afb_data_t data,
+	const afb_iovec_t **iovec
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	int rc;
+	void *ptr;
+	size_t sz;
+
+	if (afb_data_type(data) != afbBindingV4r1_itfptr->type_iovec)
+		return AFB_ERRNO_INVALID_REQUEST;
+	rc = afb_data_get_constant(data, &ptr, &sz);
+	if (rc < 0)
+		return rc;
+	*iovec = (const afb_iovec_t*)ptr;
+	return (int)(sz / sizeof(afb_iovec_t));
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
 /*  @} */
 /** DATA ARRAY ***********************************************************/
 /** @defgroup AFB_DATA_ARRAY
@@ -643,6 +1483,9 @@ afb_data_dependency_drop_all(
  * Increase the count of references of the array 'array'
  * that has 'count' data.
  *
+ * Since AFB_BINDING_X4R1_ITF_REVISION == 10, the array is
+ * processed at once by the binder.
+ *
  * @param count the count of data in the array
  * @param array the array of data
  */
@@ -652,8 +1495,13 @@ afb_data_array_addref(
 	unsigned count,
 	afb_data_t const *array
 ) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	if (count)
+		afbBindingV4r1_itfptr->data_array_addref(count, array);
+#else
 	while (count--)
 		afb_data_addref(*array++);
+#endif
 }
 
 /**
@@ -663,6 +1511,9 @@ afb_data_array_addref(
  * Call this function when the data is no more used.
  * It destroys the data when the reference count falls to zero.
  *
+ * Since AFB_BINDING_X4R1_ITF_REVISION == 10, the array is
+ * processed at once by the binder.
+ *
  * @param count the count of data in the array
  * @param array the array of data
  */
@@ -672,8 +1523,13 @@ afb_data_array_unref(
 	unsigned count,
 	afb_data_t const *array
 ) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	if (count)
+		afbBindingV4r1_itfptr->data_array_unref(count, array);
+#else
 	while (count--)
 		afb_data_unref(*array++);
+#endif
 }
 
 /**
@@ -683,6 +1539,13 @@ afb_data_array_unref(
  * If a data are returned (no error case), they MUST be released
  * using afb_data_unref.
  *
+ * In case of error, no data is returned and the items of 'array_result'
+ * are set to NULL.
+ *
+ * Since AFB_BINDING_X4R1_ITF_REVISION == 10, the array is converted
+ * at once by the binder that resolves the converter only once for
+ * each distinct couple of types.
+ *
  * @param count        count of items in the arrays
  * @param array_data   array of original data
  * @param array_type   array of expected types
@@ -698,6 +1561,9 @@ afb_data_array_convert(
 	afb_type_t const * array_type,
 	afb_data_t *array_result
 ) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->data_array_convert(count, array_data, array_type, array_result);
+#else
 	int rc = 0;
 	unsigned index = 0;
 
@@ -713,6 +1579,164 @@ afb_data_array_convert(
 		}
 	}
 	return rc;
+#endif
+}
+
+/** @} */
+/** DATA POOL ***********************************************************/
+/** @defgroup AFB_DATA_POOL
+ *  @{ */
+
+/**
+ * Creates a pool of memory for allocating data of small sizes.
+ *
+ * The memory of the pool is managed by size classes. An allocation
+ * from the pool gets a block of the smallest class fitting the required
+ * size. Released blocks are kept for reuse, first in a cache of the
+ * releasing thread, holding at most 'thread_cache' blocks per class,
+ * then in the pool. Allocations greater than the biggest class are
+ * not served by the pool but by the common allocator.
+ *
+ * The pool is released using @ref afb_data_pool_unref. Data allocated
+ * from the pool remain valid after that release.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param api           the api creating the pool
+ * @param pool          pointer to the created pool
+ * @param nclasses      count of size classes
+ * @param sizes         sizes of the classes in increasing order
+ * @param thread_cache  count of blocks per class cached by threads (can be 0)
+ *
+ * @return 0 in case of success or a negative -errno like value
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_api_data_pool_create(
+	afb_api_t api,
+	afb_data_pool_t *pool,
+	unsigned nclasses,
+	const size_t sizes[],
+	unsigned thread_cache
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->api_data_pool_create(api, pool, nclasses, sizes, thread_cache);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Add one reference to the data 'pool'
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param pool the pool to reference
+ *
+ * @return the referenced pool
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+afb_data_pool_t
+afb_data_pool_addref(
+	afb_data_pool_t pool
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->data_pool_addref(pool);
+#else
+	return pool;
+#endif
+}
+
+/**
+ * Remove one reference to the data 'pool' and
+ * destroys it if not more referenced
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param pool the pool to unreference
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+void
+afb_data_pool_unref(
+	afb_data_pool_t pool
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	afbBindingV4r1_itfptr->data_pool_unref(pool);
+#endif
+}
+
+/**
+ * Get the counters of the data 'pool'. Comparing the count of hits
+ * with the count of misses helps to tune the size classes.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param pool  the pool to query
+ * @param stats where to store the counters
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+void
+afb_data_pool_stats(
+	afb_data_pool_t pool,
+	afb_data_pool_stats_t *stats
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	afbBindingV4r1_itfptr->data_pool_stats(pool, stats);
+#endif
+}
+
+/**
+ * Creates a new data instance of the given type by allocating memory
+ * of the given size from the data 'pool'. The allocated memory filled
+ * with zeroes. The data and its memory are allocated at once.
+ *
+ * This function is equivalent to @ref afb_create_data_alloc except
+ * that the memory comes from the pool.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data     pointer to the created data
+ * @param type     type of the data to created
+ * @param pointer  pointer of the data to create
+ * @param size     size of the data to create
+ * @param pool     the pool to use
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_create_data_alloc_pooled(
+	afb_data_t *data,
+	afb_type_t type,
+	void **pointer,
+	size_t size,
+	afb_data_pool_t pool
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->create_data_alloc_pooled(data, type, pointer, size, pool);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
 }
 
 /** @} */
@@ -1616,6 +2640,60 @@ afb_type_lookup(
 	return afbBindingV4r1_itfptr->type_lookup(type, name);
 }
 
+/**
+ * Computes the identifier of the type of the given name.
+ * It is the FNV-1a 64 bits hash of the name.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param name name of the type
+ *
+ * @return the identifier of the type
+ */
+static inline
+afb_type_id_t
+afb_type_id(
+	const char *name
+) {
+	afb_type_id_t id = AFB_TYPE_ID_X4_OFFSET_BASIS;
+	while (*name)
+		id = (id ^ (unsigned char)*name++) * AFB_TYPE_ID_X4_PRIME;
+	return id;
+}
+
+/**
+ * Lookup for an existing type by its identifier, as computed
+ * by @ref afb_type_id. The lookup compares identifiers only,
+ * not names.
+ *
+ * When distinct registered names have the same identifier, the
+ * lookup fails and the name must be used.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param type pointer to the type returned if found
+ * @param id identifier of the searched type
+ *
+ * @return 0 in case of success or a negative error code
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_type_lookup_id(
+	afb_type_t *type,
+	afb_type_id_t id
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->type_lookup_id(type, id);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
 /**
  * Register a type
  *
@@ -1641,6 +2719,58 @@ afb_type_register(
 	return afbBindingV4r1_itfptr->type_register(type, name, flags);
 }
 
+/**
+ * Register a type of records: data of that type hold a structure of
+ * @p size bytes whose fields are described by @p fields.
+ *
+ * The registered type is shareable. The binder adds converters from
+ * and to @ref AFB_PREDEFINED_TYPE_JSON_C, using the names of the fields
+ * as keys of a JSON object. So local callers exchange the structures
+ * without any conversion while remote or HTTP clients receive JSON.
+ *
+ * The descriptions of the fields are not copied and must remain valid,
+ * declaring them static is the common case:
+ *
+ * ```c
+ * struct point { int32_t x, y; char label[16]; };
+ * static const afb_record_field_t point_fields[] = {
+ *     AFB_RECORD_FIELD(struct point, x, Afb_Record_Kind_I32),
+ *     AFB_RECORD_FIELD(struct point, y, Afb_Record_Kind_I32),
+ *     AFB_RECORD_FIELD(struct point, label, Afb_Record_Kind_String)
+ * };
+ * rc = afb_type_register_record(&point_type, "point", sizeof(struct point), 3, point_fields);
+ * ```
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param type pointer to the returned created type
+ * @param name name of the type to be created
+ * @param size size of the records
+ * @param nfields count of fields
+ * @param fields description of the fields
+ *
+ * @return 0 in case of success or a negative error code
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_type_register_record(
+	afb_type_t *type,
+	const char *name,
+	size_t size,
+	unsigned nfields,
+	const afb_record_field_t fields[]
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->type_register_record(type, name, size, nfields, fields);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
 /**
  * Get the name of a type
  *
@@ -1674,6 +2804,61 @@ afb_type_set_family(
 	return afbBindingV4r1_itfptr->type_set_family(type, family);
 }
 
+/**
+ * Get the family of the type, as set by @ref afb_type_set_family.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param type the type whose family is queried
+ *
+ * @return the family of the type or NULL if it has no family
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+afb_type_t
+afb_type_get_family(
+	afb_type_t type
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->type_get_family(type);
+#else
+	return NULL;
+#endif
+}
+
+/**
+ * Test if the type is the @p family or is of the @p family, directly
+ * or through the family of its family, and so on.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param type the type to test
+ * @param family the family
+ *
+ * @return 1 if the type is of the family or 0 otherwise
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_type_is_of_family(
+	afb_type_t type,
+	afb_type_t family
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	while (type != NULL && type != family)
+		type = afbBindingV4r1_itfptr->type_get_family(type);
+	return type != NULL;
+#else
+	return 0;
+#endif
+}
+
 /**
  * Add a conversion routine to a given type
  *
@@ -1716,6 +2901,80 @@ afb_type_add_convert_from(
 	return afbBindingV4r1_itfptr->type_add_converter(from_type, type, converter, closure);
 }
 
+/**
+ * Add a conversion routine to a given type, with its cost
+ *
+ * When data are converted, the binder uses the path of converters,
+ * direct or through intermediate types, whose sum of costs is the
+ * lowest. That path is searched once for each couple of types.
+ * Converters added without cost have the cost
+ * @ref AFB_TYPE_CONVERTER_DEFAULT_COST.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param type the reference type
+ * @param to_type the type to convert to
+ * @param converter the converter routine
+ * @param closure the closure for the converter
+ * @param cost the cost of the conversion
+ *
+ * @return 0 in case of success or a negative error code
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_type_add_convert_to_cost(
+	afb_type_t type,
+	afb_type_t to_type,
+	afb_type_converter_t converter,
+	void *closure,
+	unsigned cost
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->type_add_converter_cost(type, to_type, converter, closure, cost);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Add a conversion routine from a given type, with its cost
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param type the reference type
+ * @param from_type the type to convert from
+ * @param converter the converter routine
+ * @param closure the closure for the converter
+ * @param cost the cost of the conversion
+ *
+ * @return 0 in case of success or a negative error code
+ *
+ * @see afb_type_add_convert_to_cost
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_type_add_convert_from_cost(
+	afb_type_t type,
+	afb_type_t from_type,
+	afb_type_converter_t converter,
+	void *closure,
+	unsigned cost
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->type_add_converter_cost(from_type, type, converter, closure, cost);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
 /**
  * Add an update routine to a given type
  *
@@ -1758,6 +3017,81 @@ afb_type_add_update_from(
 	return afbBindingV4r1_itfptr->type_add_updater(from_type, type, updater, closure);
 }
 
+/**
+ * Get the conversion of data of type 'from_type' to data of type 'to_type'.
+ *
+ * The search of the converters, direct or chained, is done once by this
+ * call. The returned conversion can then be applied many times using
+ * afb_data_convert_with. Types being never removed, the conversion
+ * remains valid until the end of the process and needs no release.
+ *
+ * It is best called at initialisation, after the converters are added.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param from_type  the type of the data to convert
+ * @param to_type    the type of the converted data
+ * @param conversion where to store the conversion
+ *
+ * @return 0 in case of success or a negative error code,
+ *         AFB_ERRNO_NOT_AVAILABLE if no conversion exists
+ *
+ * @see afb_data_convert_with
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_type_get_converter(
+	afb_type_t from_type,
+	afb_type_t to_type,
+	afb_type_conversion_t *conversion
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->type_get_converter(from_type, to_type, conversion);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Get the cost of the cheapest conversion of data of type 'from_type'
+ * to data of type 'to_type' and the count of converters it chains.
+ * This is the path used by afb_data_convert and afb_type_get_converter.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param from_type  the type of the data to convert
+ * @param to_type    the type of the converted data
+ * @param cost       if not NULL, where to store the sum of the costs
+ * @param hops       if not NULL, where to store the count of converters
+ *
+ * @return 0 in case of success or a negative error code,
+ *         AFB_ERRNO_NOT_AVAILABLE if no conversion exists
+ *
+ * @see afb_type_add_convert_to_cost
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_type_conversion_cost(
+	afb_type_t from_type,
+	afb_type_t to_type,
+	unsigned *cost,
+	unsigned *hops
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->type_conversion_cost(from_type, to_type, cost, hops);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
 /** @} */
 /** API ***********************************************************/
 /** @defgroup AFB_API
@@ -2613,6 +3947,75 @@ afb_setup_shared_object(
 	return afbBindingV4r1_itfptr->setup_shared_object(api, handle);
 }
 
+/** @} */
+/** JSON VIEW ***********************************************************/
+/** @defgroup AFB_JSON_VIEW
+ *  @{ */
+
+/**
+ * Locates in the data of type @ref AFB_PREDEFINED_TYPE_JSON_VIEW
+ * the value designated by the JSON @p pointer (RFC 6901), for example
+ * "/args/name" or "/list/2". The empty pointer "" designates the
+ * whole value.
+ *
+ * The index of the JSON view is built at the first lookup and kept
+ * by the data, so the text is scanned only once. No json-c object
+ * is created.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data the JSON view
+ * @param pointer the JSON pointer of the value
+ * @param token where to store the location of the value
+ *
+ * @return 0 in case of success or a negative value indication the error,
+ *         AFB_ERRNO_NOT_AVAILABLE when the value does not exist
+ *
+ * @see afb_json_view_text
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+int
+afb_json_view_lookup(
+	afb_data_t data,
+	const char *pointer,
+	afb_json_token_t *token
+) {
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	return afbBindingV4r1_itfptr->json_view_lookup(data, pointer, token);
+#else
+	return AFB_ERRNO_NOT_AVAILABLE;
+#endif
+}
+
+/**
+ * Gets the text of the value located by @p token in the JSON view.
+ * The text is not terminated: its length is given by the token.
+ * For strings, the text is between the quotes and is still escaped.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ *
+ * @param data the JSON view
+ * @param token the location of the value got by afb_json_view_lookup
+ *
+ * @return the pointer to the text of the value
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION < 10
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+#endif
+static inline
+const char *
+afb_json_view_text(
+	afb_data_t data,
+	const afb_json_token_t *token
+) {
+	return (const char*)afb_data_ro_pointer(data) + token->offset;
+}
+
 /** @} */
 /** PREDEFINED TYPE ***********************************************************/
 /** @defgroup AFB_PREDEFINED_TYPE
@@ -2654,6 +4057,50 @@ afb_type_t _AFB_PREDEFINED_TYPE_BYTEARRAY_() { return NULL; }
 #define AFB_PREDEFINED_TYPE_BYTEARRAY _AFB_PREDEFINED_TYPE_BYTEARRAY_()
 #endif
 
+/**
+ * Type of scatter/gather data, made of segments of memory
+ * that are not contiguous. The pointer of the data is the
+ * array of its segments (type afb_iovec_t) and its size is
+ * the size of that array.
+ *
+ * Data of that type are created using @ref afb_create_data_iovec.
+ *
+ * The conversions to @ref AFB_PREDEFINED_TYPE_BYTEARRAY and to
+ * @ref AFB_PREDEFINED_TYPE_STRINGZ flatten the segments in contiguous
+ * memory. This is done only when the conversion is requested, so
+ * consumers that can process the segments avoid the copy.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+#define AFB_PREDEFINED_TYPE_IOVEC (afbBindingV4r1_itfptr->type_iovec)
+#else
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+static inline
+afb_type_t _AFB_PREDEFINED_TYPE_IOVEC_() { return NULL; }
+#define AFB_PREDEFINED_TYPE_IOVEC _AFB_PREDEFINED_TYPE_IOVEC_()
+#endif
+
+/**
+ * Type of JSON views: json string terminated by a zero, as
+ * @ref AFB_PREDEFINED_TYPE_JSON, with an index of its values built
+ * on need for locating values using @ref afb_json_view_lookup.
+ *
+ * Conversions from and to @ref AFB_PREDEFINED_TYPE_JSON share the text.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+#define AFB_PREDEFINED_TYPE_JSON_VIEW (afbBindingV4r1_itfptr->type_json_view)
+#else
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+static inline
+afb_type_t _AFB_PREDEFINED_TYPE_JSON_VIEW_() { return NULL; }
+#define AFB_PREDEFINED_TYPE_JSON_VIEW _AFB_PREDEFINED_TYPE_JSON_VIEW_()
+#endif
+
 /**
  * Type of boolean values
  */
@@ -2699,6 +4146,86 @@ afb_type_t _AFB_PREDEFINED_TYPE_UUID_() { return NULL; }
 #define AFB_PREDEFINED_TYPE_UUID _AFB_PREDEFINED_TYPE_UUID_()
 #endif
 
+/**
+ * Type of arrays of signed 32 bit integers (int32_t)
+ *
+ * The data of the array types hold the values contiguously, in the
+ * byte order of the host, so the count of values is the size of the
+ * data divided by the size of a value. These types convert to and
+ * from JSON arrays of numbers without creating json-c objects.
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+#define AFB_PREDEFINED_TYPE_I32_ARRAY  (afbBindingV4r1_itfptr->type_i32_array)
+#else
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+static inline
+afb_type_t _AFB_PREDEFINED_TYPE_I32_ARRAY_() { return NULL; }
+#define AFB_PREDEFINED_TYPE_I32_ARRAY _AFB_PREDEFINED_TYPE_I32_ARRAY_()
+#endif
+
+/**
+ * Type of arrays of unsigned 32 bit integers (uint32_t)
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+#define AFB_PREDEFINED_TYPE_U32_ARRAY  (afbBindingV4r1_itfptr->type_u32_array)
+#else
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+static inline
+afb_type_t _AFB_PREDEFINED_TYPE_U32_ARRAY_() { return NULL; }
+#define AFB_PREDEFINED_TYPE_U32_ARRAY _AFB_PREDEFINED_TYPE_U32_ARRAY_()
+#endif
+
+/**
+ * Type of arrays of signed 64 bit integers (int64_t)
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+#define AFB_PREDEFINED_TYPE_I64_ARRAY  (afbBindingV4r1_itfptr->type_i64_array)
+#else
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+static inline
+afb_type_t _AFB_PREDEFINED_TYPE_I64_ARRAY_() { return NULL; }
+#define AFB_PREDEFINED_TYPE_I64_ARRAY _AFB_PREDEFINED_TYPE_I64_ARRAY_()
+#endif
+
+/**
+ * Type of arrays of single precision floats (float)
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+#define AFB_PREDEFINED_TYPE_F32_ARRAY  (afbBindingV4r1_itfptr->type_f32_array)
+#else
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+static inline
+afb_type_t _AFB_PREDEFINED_TYPE_F32_ARRAY_() { return NULL; }
+#define AFB_PREDEFINED_TYPE_F32_ARRAY _AFB_PREDEFINED_TYPE_F32_ARRAY_()
+#endif
+
+/**
+ * Type of arrays of double precision floats (double)
+ *
+ * @since 4.4.0
+ * @since AFB_BINDING_X4R1_ITF_REVISION == 10
+ */
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+#define AFB_PREDEFINED_TYPE_F64_ARRAY  (afbBindingV4r1_itfptr->type_f64_array)
+#else
+__attribute__((error("Requires AFB_BINDING_X4R1_ITF_REVISION >= 10")))
+static inline
+afb_type_t _AFB_PREDEFINED_TYPE_F64_ARRAY_() { return NULL; }
+#define AFB_PREDEFINED_TYPE_F64_ARRAY _AFB_PREDEFINED_TYPE_F64_ARRAY_()
+#endif
+
 /** @} */
 /** FD's EVENT HANDLING ***********************************************************/
 /** @defgroup AFB_EVFD
@@ -0,0 +1,541 @@
+/*
+ * Copyright (C) 2015-2026 IoT.bzh Company
+ * Author: José Bollo <jose.bollo@iot.bzh>
+ *
+ * SPDX-License-Identifier: LGPL-3.0-only
+ */
+
+/**< @file afb/afb-json-writer.h */
+
+#pragma once
+
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <locale.h>
+
+#include "afb-binding.h"
+
+#if AFB_BINDING_VERSION != 4
+# error "afb-json-writer.h requires AFB_BINDING_VERSION 4"
+#endif
+
+/** JSON WRITER ***********************************************************/
+/** @defgroup AFB_JSON_WRITER
+ *  @{ */
+
+/**
+ * Writer of JSON text in a growable buffer.
+ *
+ * The JSON text is appended directly to the buffer without building
+ * intermediate objects. At end, the buffer becomes, without copy,
+ * a data of type @ref AFB_PREDEFINED_TYPE_JSON, see
+ * @ref afb_json_writer_to_data.
+ *
+ * Errors are sticky: after the first error, the writer ignores
+ * the next writes and reports the error at end.
+ *
+ * The writer puts the commas between items but does not check
+ * the structure of the written text: keys must be written
+ * in objects before each value and only there.
+ *
+ * ```c
+ * afb_json_writer_t writer;
+ * afb_json_writer_init(&writer);
+ * afb_json_writer_begin_object(&writer);
+ * afb_json_writer_key(&writer, "count");
+ * afb_json_writer_int(&writer, 10);
+ * afb_json_writer_end_object(&writer);
+ * rc = afb_json_writer_to_data(&writer, &data);
+ * ```
+ */
+struct afb_json_writer
+{
+	/** the buffer of the text */
+	char *buffer;
+
+	/** length of the text */
+	size_t length;
+
+	/** allocated size of the buffer */
+	size_t capacity;
+
+	/** first error or 0 */
+	int error;
+
+	/** is a comma needed before the next item? */
+	int comma;
+};
+
+typedef struct afb_json_writer afb_json_writer_t;
+
+/**
+ * Initial size of the buffer of writers
+ */
+#define AFB_JSON_WRITER_INITIAL_CAPACITY 256
+
+/**
+ * Initialise the writer with an empty text
+ *
+ * @param writer the writer to initialise
+ */
+static inline
+void
+afb_json_writer_init(
+	afb_json_writer_t *writer
+) {
+	writer->buffer = NULL;
+	writer->length = 0;
+	writer->capacity = 0;
+	writer->error = 0;
+	writer->comma = 0;
+}
+
+/**
+ * Release the resources of the writer and reset it to an empty text
+ *
+ * @param writer the writer to release
+ */
+static inline
+void
+afb_json_writer_release(
+	afb_json_writer_t *writer
+) {
+	free(writer->buffer);
+	afb_json_writer_init(writer);
+}
+
+/**
+ * Get the error status of the writer
+ *
+ * @param writer the writer
+ *
+ * @return 0 if no error occured or the first error code
+ */
+static inline
+int
+afb_json_writer_error(
+	const afb_json_writer_t *writer
+) {
+	return writer->error;
+}
+
+/**
+ * Ensure that the buffer can receive 'size' more bytes
+ * and the terminating zero
+ *
+ * @param writer the writer
+ * @param size   the count of bytes to be added
+ *
+ * @return 0 in case of success or a negative error code
+ */
+static inline
+int
+afb_json_writer_reserve(
+	afb_json_writer_t *writer,
+	size_t size
+) {
+	char *buffer;
+	size_t capacity, needed = writer->length + size + 1;
+
+	if (writer->error == 0 && needed > writer->capacity) {
+		capacity = writer->capacity ? writer->capacity : AFB_JSON_WRITER_INITIAL_CAPACITY;
+		while (capacity < needed)
+			capacity <<= 1;
+		buffer = (char*)realloc(writer->buffer, capacity);
+		if (buffer == NULL)
+			writer->error = AFB_ERRNO_OUT_OF_MEMORY;
+		else {
+			writer->buffer = buffer;
+			writer->capacity = capacity;
+		}
+	}
+	return writer->error;
+}
+
+/**
+ * Append the bytes to the text, without any processing
+ *
+ * @param writer the writer
+ * @param text   the bytes to append
+ * @param length the count of bytes
+ */
+static inline
+void
+afb_json_writer_put(
+	afb_json_writer_t *writer,
+	const char *text,
+	size_t length
+) {
+	if (afb_json_writer_reserve(writer, length) == 0) {
+		memcpy(&writer->buffer[writer->length], text, length);
+		writer->length += length;
+	}
+}
+
+/**
+ * Append the comma if needed before a new item
+ *
+ * @param writer the writer
+ * @param next_comma is a comma needed after the new item
+ */
+static inline
+void
+afb_json_writer_item(
+	afb_json_writer_t *writer,
+	int next_comma
+) {
+	if (writer->comma)
+		afb_json_writer_put(writer, ",", 1);
+	writer->comma = next_comma;
+}
+
+/**
+ * Begin an object: writes '{'
+ *
+ * @param writer the writer
+ */
+static inline
+void
+afb_json_writer_begin_object(
+	afb_json_writer_t *writer
+) {
+	afb_json_writer_item(writer, 0);
+	afb_json_writer_put(writer, "{", 1);
+}
+
+/**
+ * End an object: writes '}'
+ *
+ * @param writer the writer
+ */
+static inline
+void
+afb_json_writer_end_object(
+	afb_json_writer_t *writer
+) {
+	afb_json_writer_put(writer, "}", 1);
+	writer->comma = 1;
+}
+
+/**
+ * Begin an array: writes '['
+ *
+ * @param writer the writer
+ */
+static inline
+void
+afb_json_writer_begin_array(
+	afb_json_writer_t *writer
+) {
+	afb_json_writer_item(writer, 0);
+	afb_json_writer_put(writer, "[", 1);
+}
+
+/**
+ * End an array: writes ']'
+ *
+ * @param writer the writer
+ */
+static inline
+void
+afb_json_writer_end_array(
+	afb_json_writer_t *writer
+) {
+	afb_json_writer_put(writer, "]", 1);
+	writer->comma = 1;
+}
+
+/**
+ * Append the string of given length, quoted and escaped
+ *
+ * @param writer the writer
+ * @param string the string
+ * @param length the length of the string
+ */
+static inline
+void
+afb_json_writer_quoted(
+	afb_json_writer_t *writer,
+	const char *string,
+	size_t length
+) {
+	static const char hex[] = "0123456789abcdef";
+	char esc[6];
+	size_t begin = 0, end = 0;
+	unsigned char c;
+
+	afb_json_writer_put(writer, "\"", 1);
+	while (end < length) {
+		c = (unsigned char)string[end];
+		if (c >= ' ' && c != '"' && c != '\\')
+			end++;
+		else {
+			afb_json_writer_put(writer, &string[begin], end - begin);
+			esc[0] = '\\';
+			switch (c) {
+			case '"': case '\\': esc[1] = (char)c; break;
+			case '\b': esc[1] = 'b'; break;
+			case '\f': esc[1] = 'f'; break;
+			case '\n': esc[1] = 'n'; break;
+			case '\r': esc[1] = 'r'; break;
+			case '\t': esc[1] = 't'; break;
+			default:
+				esc[1] = 'u';
+				esc[2] = '0';
+				esc[3] = '0';
+				esc[4] = hex[c >> 4];
+				esc[5] = hex[c & 15];
+				break;
+			}
+			afb_json_writer_put(writer, esc, esc[1] == 'u' ? 6 : 2);
+			begin = ++end;
+		}
+	}
+	afb_json_writer_put(writer, &string[begin], end - begin);
+	afb_json_writer_put(writer, "\"", 1);
+}
+
+/**
+ * Write the key of the next value of an object
+ *
+ * @param writer the writer
+ * @param key    the key, a zero terminated string
+ */
+static inline
+void
+afb_json_writer_key(
+	afb_json_writer_t *writer,
+	const char *key
+) {
+	afb_json_writer_item(writer, 0);
+	afb_json_writer_quoted(writer, key, strlen(key));
+	afb_json_writer_put(writer, ":", 1);
+}
+
+/**
+ * Write a string value of given length
+ *
+ * @param writer the writer
+ * @param string the string
+ * @param length the length of the string
+ */
+static inline
+void
+afb_json_writer_string_len(
+	afb_json_writer_t *writer,
+	const char *string,
+	size_t length
+) {
+	afb_json_writer_item(writer, 1);
+	afb_json_writer_quoted(writer, string, length);
+}
+
+/**
+ * Write a string value or null if the string is NULL
+ *
+ * @param writer the writer
+ * @param string the zero terminated string or NULL
+ */
+static inline
+void
+afb_json_writer_string(
+	afb_json_writer_t *writer,
+	const char *string
+) {
+	afb_json_writer_item(writer, 1);
+	if (string == NULL)
+		afb_json_writer_put(writer, "null", 4);
+	else
+		afb_json_writer_quoted(writer, string, strlen(string));
+}
+
+/**
+ * Write the value null
+ *
+ * @param writer the writer
+ */
+static inline
+void
+afb_json_writer_null(
+	afb_json_writer_t *writer
+) {
+	afb_json_writer_item(writer, 1);
+	afb_json_writer_put(writer, "null", 4);
+}
+
+/**
+ * Write a boolean value
+ *
+ * @param writer the writer
+ * @param value  the value, true if not zero
+ */
+static inline
+void
+afb_json_writer_bool(
+	afb_json_writer_t *writer,
+	int value
+) {
+	afb_json_writer_item(writer, 1);
+	if (value)
+		afb_json_writer_put(writer, "true", 4);
+	else
+		afb_json_writer_put(writer, "false", 5);
+}
+
+/**
+ * Write a signed integer value
+ *
+ * @param writer the writer
+ * @param value  the value
+ */
+static inline
+void
+afb_json_writer_int(
+	afb_json_writer_t *writer,
+	int64_t value
+) {
+	char text[24];
+	int len = snprintf(text, sizeof text, "%lld", (long long)value);
+	afb_json_writer_item(writer, 1);
+	afb_json_writer_put(writer, text, (size_t)len);
+}
+
+/**
+ * Write an unsigned integer value
+ *
+ * @param writer the writer
+ * @param value  the value
+ */
+static inline
+void
+afb_json_writer_uint(
+	afb_json_writer_t *writer,
+	uint64_t value
+) {
+	char text[24];
+	int len = snprintf(text, sizeof text, "%llu", (unsigned long long)value);
+	afb_json_writer_item(writer, 1);
+	afb_json_writer_put(writer, text, (size_t)len);
+}
+
+/**
+ * Write a double value, null if the value is not finite
+ *
+ * The value is written with 17 significant digits, enough for reading
+ * back the same value. The decimal separator is always '.' whatever
+ * the locale (LC_NUMERIC) is.
+ *
+ * @param writer the writer
+ * @param value  the value
+ */
+static inline
+void
+afb_json_writer_double(
+	afb_json_writer_t *writer,
+	double value
+) {
+	char text[40], *pos;
+	const char *point;
+	size_t len, plen;
+
+	if (!isfinite(value))
+		afb_json_writer_null(writer);
+	else {
+		len = (size_t)snprintf(text, sizeof text, "%.17g", value);
+
+		/* replace the decimal point of the locale by '.' */
+		point = localeconv()->decimal_point;
+		plen = strlen(point);
+		if (plen > 0 && (plen > 1 || point[0] != '.')) {
+			pos = strstr(text, point);
+			if (pos != NULL) {
+				*pos = '.';
+				memmove(pos + 1, pos + plen, len - (size_t)(pos - text) - plen + 1);
+				len -= plen - 1;
+			}
+		}
+		afb_json_writer_item(writer, 1);
+		afb_json_writer_put(writer, text, len);
+	}
+}
+
+/**
+ * Write a value given as JSON text, without checking it
+ *
+ * @param writer the writer
+ * @param json   the JSON text of the value
+ * @param length the length of the text
+ */
+static inline
+void
+afb_json_writer_raw(
+	afb_json_writer_t *writer,
+	const char *json,
+	size_t length
+) {
+	afb_json_writer_item(writer, 1);
+	afb_json_writer_put(writer, json, length);
+}
+
+/**
+ * Get the written text, terminated by a zero
+ *
+ * The text remains owned by the writer.
+ *
+ * @param writer the writer
+ * @param length if not NULL, where to store the length of the text
+ *
+ * @return the text or NULL on error
+ */
+static inline
+const char *
+afb_json_writer_text(
+	afb_json_writer_t *writer,
+	size_t *length
+) {
+	if (afb_json_writer_reserve(writer, 0) != 0)
+		return NULL;
+	writer->buffer[writer->length] = 0;
+	if (length)
+		*length = writer->length;
+	return writer->buffer;
+}
+
+/**
+ * Create a data of type @ref AFB_PREDEFINED_TYPE_JSON with the written
+ * text and reset the writer to an empty text. The buffer is given to the
+ * data without copy.
+ *
+ * In case of error, the writer is also released.
+ *
+ * @param writer the writer
+ * @param data   where to store the created data
+ *
+ * @return 0 in case of success or a negative error code
+ */
+static inline
+int
+afb_json_writer_to_data(
+	afb_json_writer_t *writer,
+	afb_data_t *data
+) {
+	size_t length;
+	const char *text = afb_json_writer_text(writer, &length);
+	int rc = writer->error;
+
+	if (rc == 0) {
+		rc = afb_create_data_raw(data, AFB_PREDEFINED_TYPE_JSON,
+				text, length + 1, free, (void*)text);
+		afb_json_writer_init(writer);
+	}
+	else {
+		afb_json_writer_release(writer);
+	}
+	return rc;
+}
+
+/** @} */
@@ -16,6 +16,14 @@
 #include <vector>
 #include <stdexcept>
 #include <memory>
+#include <type_traits>
+#include <initializer_list>
+#include <atomic>
+
+/* check escaping of views (see afb::data_view) when set to 1 */
+#if !defined(AFB_BINDING_CHECK_VIEWS)
+# define AFB_BINDING_CHECK_VIEWS 0
+#endif
 
 /* check the version */
 #if !defined(AFB_BINDING_VERSION)
@@ -37,6 +45,9 @@ namespace afb {
 class api;
 class arg;
 class data;
+class data_ref;
+template <unsigned inline_count_> class data_vector;
+template <unsigned capacity_> class data_array;
 class event;
 class req;
 class type;
@@ -203,6 +214,18 @@ public: create_data_error(const char *arg) : error{arg} {}
 class type;
 class data;
 
+/**
+ * identifier of the type of the given name (FNV-1a 64 bits hash),
+ * computed at compile time for constant names
+ */
+constexpr afb_type_id_t type_id(const char *name) noexcept
+{
+	afb_type_id_t id = AFB_TYPE_ID_X4_OFFSET_BASIS;
+	while (*name)
+		id = (id ^ static_cast<unsigned char>(*name++)) * AFB_TYPE_ID_X4_PRIME;
+	return id;
+}
+
 /**
  * class wrapping afb_type_t
  */
@@ -214,8 +237,14 @@ protected:
 
 	/** internal lookup */
 	void _lookup_(const char *name)
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+		{ if (afb_type_lookup_id(&type_, type_id(name)) < 0
+		   && afb_type_lookup(&type_, name) < 0)
+			throw type_not_found_error("type-not-found"); }
+#else
 		{ if (afb_type_lookup(&type_, name) < 0)
 			throw type_not_found_error("type-not-found"); }
+#endif
 
 public:
 	/** default constructor */
@@ -236,6 +265,20 @@ public:
 	type(const std::string &name)
 		{ _lookup_(name.c_str()); }
 
+	/**
+	 * type of the given name, looked up only once by the program;
+	 * id_ must be type_id(name), see the macro AFB_TYPE
+	 */
+	template <afb_type_id_t id_>
+	static type named(const char *name)
+		{ static std::atomic<afb_type_t> memo{nullptr};
+		  afb_type_t t = memo.load(std::memory_order_relaxed);
+		  if (t == nullptr) {
+			t = type(name).type_;
+			memo.store(t, std::memory_order_relaxed);
+		  }
+		  return type(t); }
+
 	/** unwrap */
 	operator afb_type_t() const noexcept
 		{ return type_; }
@@ -265,6 +308,14 @@ public:
 	bool operator ==(const type &other) const noexcept
 		{ return type_ == other.type_; }
 
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	/** family */
+	type family() const noexcept
+		{ return type(afb_type_get_family(type_)); }
+	bool is_of_family(const type &family) const noexcept
+		{ return afb_type_is_of_family(type_, family.type_); }
+#endif
+
 	/** name */
 	const char *name() const {
 		validate();
@@ -289,6 +340,66 @@ public:
 		{ return exists(name.c_str()); }
 };
 
+/**
+ * traits of the C++ types that have a predefined afb type
+ *
+ * For these types, 'is_predefined' is true, 'value_type' is the
+ * type of the stored value and 'type()' returns the predefined type.
+ */
+template <class T>
+struct data_traits
+{
+	static constexpr bool is_predefined = false;
+};
+
+template <>
+struct data_traits<bool>
+{
+	static constexpr bool is_predefined = true;
+	using value_type = char;
+	static afb_type_t type() { return AFB_PREDEFINED_TYPE_BOOL; }
+};
+
+template <>
+struct data_traits<int32_t>
+{
+	static constexpr bool is_predefined = true;
+	using value_type = int32_t;
+	static afb_type_t type() { return AFB_PREDEFINED_TYPE_I32; }
+};
+
+template <>
+struct data_traits<uint32_t>
+{
+	static constexpr bool is_predefined = true;
+	using value_type = uint32_t;
+	static afb_type_t type() { return AFB_PREDEFINED_TYPE_U32; }
+};
+
+template <>
+struct data_traits<int64_t>
+{
+	static constexpr bool is_predefined = true;
+	using value_type = int64_t;
+	static afb_type_t type() { return AFB_PREDEFINED_TYPE_I64; }
+};
+
+template <>
+struct data_traits<uint64_t>
+{
+	static constexpr bool is_predefined = true;
+	using value_type = uint64_t;
+	static afb_type_t type() { return AFB_PREDEFINED_TYPE_U64; }
+};
+
+template <>
+struct data_traits<double>
+{
+	static constexpr bool is_predefined = true;
+	using value_type = double;
+	static afb_type_t type() { return AFB_PREDEFINED_TYPE_DOUBLE; }
+};
+
 /**
  * class wrapping afb_data_t
  */
@@ -357,6 +468,17 @@ public:
 	~data()
 		{}
 
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	/** creation of a data of predefined type storing the value inside the data */
+	template <class T>
+	static data of(T value)
+		{ static_assert(data_traits<T>::is_predefined, "not a predefined type");
+		  typename data_traits<T>::value_type val = value;
+		  data result;
+		  result._create_(afb_create_data_inline(&result.data_, data_traits<T>::type(), &val, sizeof val));
+		  return result; }
+#endif
+
 	/** unwrap */
 	operator afb_data_t() const
 		{ return data_; }
@@ -405,9 +527,357 @@ public:
 	size_t size() const
 		{ return afb_data_size(data_); }
 
+	/** notify that the value changed */
+	void notify_changed() const
+		{ afb_data_notify_changed(data_); }
+
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	/** call watcher(closure, data) after each change, see afb_data_watch */
+	void watch(afb_data_watcher_t watcher, void *closure) const
+		{ if (afb_data_watch(data_, watcher, closure) < 0)
+			throw invalid_data_error("watch-data-failed"); }
+
+	/** stop calling watcher(closure, data) */
+	void unwatch(afb_data_watcher_t watcher, void *closure) const noexcept
+		{ afb_data_unwatch(data_, watcher, closure); }
+
+	/** call watcher_(closure, data) after each change */
+	template <class T, void (*watcher_)(T *closure, afb::data data)>
+	void watch(T *closure) const
+		{ watch(_watcher_<T, watcher_>, closure); }
+
+	/** stop calling watcher_(closure, data) */
+	template <class T, void (*watcher_)(T *closure, afb::data data)>
+	void unwatch(T *closure) const noexcept
+		{ unwatch(_watcher_<T, watcher_>, closure); }
+#endif
+
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	/** update in place from the value of an other data, see afb_data_convert_into */
+	data &update_from(const data &from)
+		{ if (afb_data_convert_into(from.data_, data_) < 0)
+			throw convert_data_error("update-data-failed");
+		  return *this; }
+#endif
+
 	/** conversion */
 	data convert(afb::type t) const
 		{ return data(t, *this); }
+
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	/** conversion remembered by the data, the result is borrowed, see afb_data_convert_cached */
+	data convert_cached(afb::type t) const
+		{ afb_data_t result;
+		  if (afb_data_convert_cached(data_, t, &result) < 0)
+			throw convert_data_error("convert-data-failed");
+		  return data(result); }
+#endif
+
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	/** read only pointer if the data is of the family, nullptr otherwise */
+	template <class T = void>
+	const T *as_family(afb::type family) const noexcept
+		{ const void *ptr;
+		  return afb_data_as_family(data_, family, &ptr) < 0
+			? nullptr : static_cast<const T*>(ptr); }
+#endif
+
+	/** value of predefined type, converted only if needed */
+	template <class T>
+	T as() const;
+
+private:
+	/** adaptor of typed watchers */
+	template <class T, void (*watcher_)(T *closure, afb::data data)>
+	static void _watcher_(void *closure, afb_data_t a_data)
+		{ watcher_(static_cast<T*>(closure), afb::data(a_data)); }
+};
+
+/**
+ * class giving typed access to the value of a data of predefined type
+ *
+ * When the data already has the predefined type of T, its value is
+ * accessed directly. Otherwise the data is converted and the converted
+ * data is held until destruction.
+ */
+template <class T>
+class typed_data
+{
+	static_assert(data_traits<T>::is_predefined, "not a predefined type");
+	using value_type = typename data_traits<T>::value_type;
+
+	/** the data of predefined type */
+	afb_data_t data_;
+
+	/** is the data a conversion to release? */
+	bool converted_;
+
+	/** the value */
+	const value_type *value_;
+
+public:
+	/** initialisation constructor */
+	typed_data(afb_data_t a_data)
+		: data_{a_data}, converted_{false}
+		{ afb_type_t t = data_traits<T>::type();
+		  if (afb_data_type(a_data) != t) {
+			if (afb_data_convert(a_data, t, &data_) < 0)
+				throw convert_data_error("convert-data-failed");
+			converted_ = true;
+		  }
+		  value_ = reinterpret_cast<const value_type*>(afb_data_ro_pointer(data_)); }
+
+	/* copy method */
+	typed_data(const typed_data &other) = delete;
+	typed_data &operator=(const typed_data &other) = delete;
+
+	/** move constructor */
+	typed_data(typed_data &&other) noexcept
+		: data_{other.data_}, converted_{other.converted_}, value_{other.value_}
+		{ other.converted_ = false; }
+
+	/** destruction */
+	~typed_data()
+		{ if (converted_)
+			afb_data_unref(data_); }
+
+	/** access the value */
+	T value() const noexcept
+		{ return T(*value_); }
+	operator T() const noexcept
+		{ return value(); }
+	T operator *() const noexcept
+		{ return value(); }
+
+	/** the data of predefined type */
+	afb::data data() const noexcept
+		{ return afb::data(data_); }
+};
+
+/** value of predefined type, converted only if needed */
+template <class T>
+inline T data::as() const
+	{ return typed_data<T>(data_).value(); }
+
+/**
+ * class owning one reference of a data
+ *
+ * It can be moved, transferring the reference without changing
+ * the reference count, but not copied. The reference is released
+ * at destruction.
+ */
+class data_ref
+{
+protected:
+	/** owned data */
+	afb_data_t data_;
+
+	/** take the reference, see adopt */
+	explicit data_ref(afb_data_t a_data) noexcept
+		: data_{a_data} {}
+
+public:
+	/** default constructor */
+	data_ref() noexcept
+		: data_{nullptr} {}
+
+	/** take over the reference of the data given by the caller */
+	static data_ref adopt(afb_data_t a_data) noexcept
+		{ return data_ref(a_data); }
+
+	/** get a new reference of the data */
+	static data_ref acquire(afb_data_t a_data) noexcept
+		{ afb_data_addref(a_data);
+		  return data_ref(a_data); }
+
+	/* copy and move */
+	data_ref(const data_ref &other) = delete;
+	data_ref &operator=(const data_ref &other) = delete;
+	data_ref(data_ref &&other) noexcept
+		: data_{other.data_} { other.data_ = nullptr; }
+	data_ref &operator=(data_ref &&other) noexcept
+		{ std::swap(data_, other.data_);
+		  return *this; }
+
+	/** destruction */
+	~data_ref()
+		{ if (data_ != nullptr)
+			afb_data_unref(data_); }
+
+	/** get an other reference of the data */
+	data_ref share() const noexcept
+		{ return acquire(data_); }
+
+	/** release the reference and forget the data */
+	void reset() noexcept
+		{ data_ref().swap(*this); }
+
+	/** forget the data and give its reference to the caller */
+	afb_data_t release() noexcept
+		{ afb_data_t result = data_;
+		  data_ = nullptr;
+		  return result; }
+
+	/** exchange */
+	void swap(data_ref &other) noexcept
+		{ std::swap(data_, other.data_); }
+
+	/** access, no reference is given */
+	afb_data_t get() const noexcept
+		{ return data_; }
+	afb::data data() const noexcept
+		{ return afb::data(data_); }
+	operator afb_data_t() const noexcept
+		{ return data_; }
+
+	/** validation */
+	bool is_valid() const
+		{ return afb_data_is_valid(data_); }
+	void validate() const
+		{ if (!is_valid())
+			throw invalid_data_error("invalid-data"); }
+
+	/** access components */
+	afb::type type() const;
+	void *pointer() const
+		{ return afb_data_ro_pointer(data_); }
+	size_t size() const
+		{ return afb_data_size(data_); }
+
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	/** mutable pointer, the owned reference is replaced by a copy if shared */
+	void *mutate()
+		{ void *ptr;
+		  if (afb_data_get_mutable_cow(&data_, &ptr, nullptr) < 0)
+			throw invalid_data_error("mutate-data-failed");
+		  return ptr; }
+#endif
+
+	/** value of predefined type, converted only if needed */
+	template <class T>
+	T as() const
+		{ return typed_data<T>(data_).value(); }
+};
+
+/**
+ * vector of owned references of data
+ *
+ * Up to inline_count_ data are stored in the object itself,
+ * more data are stored in allocated memory.
+ */
+template <unsigned inline_count_ = 8>
+class data_vector
+{
+	static_assert(inline_count_ > 0, "data_vector requires an inline count of at least 1");
+protected:
+	/** the array of data: inline_ or allocated */
+	afb_data_t *array_;
+
+	/** count of data */
+	unsigned size_;
+
+	/** capacity of the array */
+	unsigned capacity_;
+
+	/** inline storage */
+	afb_data_t inline_[inline_count_];
+
+	/** ensure capacity for 'count' data */
+	void _reserve_(unsigned count)
+		{ if (count > capacity_) {
+			unsigned capa = 2 * capacity_;
+			if (capa < count)
+				capa = count;
+			afb_data_t *array = reinterpret_cast<afb_data_t*>(malloc(capa * sizeof *array));
+			if (array == nullptr)
+				throw std::bad_alloc();
+			for (unsigned idx = 0 ; idx < size_ ; idx++)
+				array[idx] = array_[idx];
+			if (array_ != inline_)
+				free(array_);
+			array_ = array;
+			capacity_ = capa;
+		  } }
+
+	/** release all the data and storage */
+	void _clear_() noexcept
+		{ afb_data_array_unref(size_, array_);
+		  if (array_ != inline_)
+			free(array_);
+		  array_ = inline_;
+		  size_ = 0;
+		  capacity_ = inline_count_; }
+
+	/** take the content of other */
+	void _take_(data_vector &other) noexcept
+		{ if (other.array_ != other.inline_)
+			array_ = other.array_;
+		  else {
+			array_ = inline_;
+			for (unsigned idx = 0 ; idx < other.size_ ; idx++)
+				inline_[idx] = other.inline_[idx];
+		  }
+		  size_ = other.size_;
+		  capacity_ = other.capacity_;
+		  other.array_ = other.inline_;
+		  other.size_ = 0;
+		  other.capacity_ = inline_count_; }
+
+public:
+	/** default constructor */
+	data_vector() noexcept
+		: array_{inline_}, size_{0}, capacity_{inline_count_} {}
+
+	/* copy and move */
+	data_vector(const data_vector &other) = delete;
+	data_vector &operator=(const data_vector &other) = delete;
+	data_vector(data_vector &&other) noexcept
+		{ _take_(other); }
+	data_vector &operator=(data_vector &&other) noexcept
+		{ if (this != &other) {
+			_clear_();
+			_take_(other);
+		  }
+		  return *this; }
+
+	/** destruction */
+	~data_vector()
+		{ _clear_(); }
+
+	/** count of data */
+	unsigned size() const noexcept
+		{ return size_; }
+	bool empty() const noexcept
+		{ return size_ == 0; }
+
+	/** reserve storage for 'count' data */
+	void reserve(unsigned count)
+		{ _reserve_(count); }
+
+	/** append a data, taking its reference */
+	void push_back(data_ref &&item)
+		{ _reserve_(size_ + 1);
+		  array_[size_++] = item.release(); }
+
+	/** release all the data */
+	void clear() noexcept
+		{ _clear_(); }
+
+	/** access, no reference is given */
+	afb::data operator[](unsigned idx) const noexcept
+		{ return afb::data(array_[idx]); }
+	afb::data operator[](int idx) const noexcept
+		{ return afb::data(array_[idx]); }
+	afb::data at(unsigned idx) const
+		{ if (idx >= size_)
+			throw std::out_of_range("out of range");
+		  return afb::data(array_[idx]); }
+	afb_data_t const *data() const noexcept
+		{ return array_; }
+
+	/** forget the data whose references were given away */
+	void forget() noexcept
+		{ size_ = 0; }
 };
 
 /*************************************************************************/
@@ -432,6 +902,16 @@ inline data type::convert(data other_data) const {
 	return data(*this, other_data);
 }
 
+/*************************************************************************/
+/* effective members of class afb::data_ref                              */
+/*************************************************************************/
+
+inline afb::type data_ref::type() const
+	{ return afb::type(afb_data_type(data_)); }
+
+/** type of the constant name, looked up once */
+#define AFB_TYPE(name) (afb::type::named<afb::type_id(name)>(name))
+
 /** predefined types */
 static inline type OPAQUE() { return type(AFB_PREDEFINED_TYPE_OPAQUE); }
 static inline type STRINGZ() { return type(AFB_PREDEFINED_TYPE_STRINGZ); }
@@ -444,6 +924,13 @@ static inline type U32() { return type(AFB_PREDEFINED_TYPE_U32); }
 static inline type I64() { return type(AFB_PREDEFINED_TYPE_I64); }
 static inline type U64() { return type(AFB_PREDEFINED_TYPE_U64); }
 static inline type DOUBLE() { return type(AFB_PREDEFINED_TYPE_DOUBLE); }
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+static inline type I32_ARRAY() { return type(AFB_PREDEFINED_TYPE_I32_ARRAY); }
+static inline type U32_ARRAY() { return type(AFB_PREDEFINED_TYPE_U32_ARRAY); }
+static inline type I64_ARRAY() { return type(AFB_PREDEFINED_TYPE_I64_ARRAY); }
+static inline type F32_ARRAY() { return type(AFB_PREDEFINED_TYPE_F32_ARRAY); }
+static inline type F64_ARRAY() { return type(AFB_PREDEFINED_TYPE_F64_ARRAY); }
+#endif
 
 /** legacy predefined types */
 inline type type_opaque() { return OPAQUE(); }
@@ -460,38 +947,145 @@ inline type type_json_c() { return JSON_C(); }
 /*************************************************************************/
 
 
+template <unsigned count_> class dataset_builder;
+
 /**
- * class intended to manage received set of data: params,
- * and asynchronous replies
+ * class intended to manage set of data sent in replies or events
+ *
+ * Up to capacity_ data are stored inline, without allocation.
+ * The data are not owned: their references are given when the set
+ * is replied or pushed.
  */
-template <unsigned count_>
-class dataset
+template <unsigned capacity_>
+class data_array
 {
+	static_assert(capacity_ > 0, "data_array requires a capacity of at least 1");
+	friend class dataset_builder<capacity_>;
 protected:
-	afb_data_t array_[count_];
+	afb_data_t array_[capacity_];
+	unsigned size_;
 public:
-	dataset() {}
-
-	/* copy method */
-	dataset(const dataset &other) = delete;
+	data_array() noexcept : size_{0} {}
+	data_array(std::initializer_list<afb::data> items) : size_{0}
+		{ for (const afb::data &item : items)
+			push_back(item); }
+
+	/* copy and move methods */
+	data_array(const data_array &other) = delete;
+	data_array &operator=(const data_array &other) = delete;
+	data_array(data_array &&other) noexcept : size_{other.size_}
+		{ for (unsigned idx = 0 ; idx < size_ ; idx++)
+			array_[idx] = other.array_[idx];
+		  other.size_ = 0; }
 
 	class ref {
 	private:
 		afb_data_t *item_;
-		friend class dataset;
+		friend class data_array;
 		ref(afb_data_t *item) : item_{item} {}
 	public:
 		operator afb::data() const { return data(*item_); }
 		ref operator=(const data &data) const { *item_ = data; return *this; }
 	};
 
+	/* append */
+	void push_back(afb_data_t item)
+		{ if (size_ >= capacity_)
+			throw std::out_of_range("out of range");
+		  array_[size_++] = item; }
+	void push_back(afb::data &&item)
+		{ push_back(afb_data_t(item));
+		  item = nullptr; }
+	void clear() noexcept { size_ = 0; }
+
 	/* access */
 	ref operator[](int idx) { return ref(&array_[idx]); }
 	ref operator[](unsigned idx) { return ref(&array_[idx]); }
-	unsigned count() const { return count_; }
+	unsigned size() const { return size_; }
+	unsigned count() const { return size_; }
+	static constexpr unsigned capacity() { return capacity_; }
 	afb_data_t const *data() const { return array_; }
 };
 
+/**
+ * class intended to manage received set of data: params,
+ * and asynchronous replies
+ *
+ * Legacy set of exactly count_ data, prefer data_array.
+ */
+template <unsigned count_>
+class dataset : public data_array<count_>
+{
+	friend class dataset_builder<count_>;
+public:
+	dataset() { this->size_ = count_; }
+};
+
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+/**
+ * class for creating all the data of a dataset in one call
+ *
+ * The descriptions are recorded using 'add' and the data are
+ * created at once using 'build'. The recorded descriptions that
+ * were not built are disposed at destruction.
+ */
+template <unsigned count_>
+class dataset_builder
+{
+protected:
+	/** recorded descriptions */
+	afb_data_desc_t descs_[count_];
+
+	/** count of recorded descriptions */
+	unsigned index_;
+
+	/** dispose the recorded descriptions */
+	void _dispose_() noexcept
+		{ while (index_) {
+			afb_data_desc_t &desc = descs_[--index_];
+			if (desc.dispose)
+				desc.dispose(desc.closure);
+		  } }
+
+public:
+	/** default constructor */
+	dataset_builder() noexcept
+		: index_{0} {}
+
+	/* copy method */
+	dataset_builder(const dataset_builder &other) = delete;
+
+	/** destruction */
+	~dataset_builder()
+		{ _dispose_(); }
+
+	/** record the description of one data */
+	dataset_builder &add(afb_type_t a_type, const void *pointer, size_t size, void (*dispose)(void*) = nullptr, void *closure = nullptr)
+		{ if (index_ >= count_) {
+			if (dispose)
+				dispose(closure);
+			throw std::out_of_range("out of range");
+		  }
+		  descs_[index_++] = { a_type, pointer, size, dispose, closure };
+		  return *this; }
+	dataset_builder &add(afb::type type, const void *pointer, size_t size, void (*dispose)(void*) = nullptr, void *closure = nullptr)
+		{ return add(afb_type_t(type), pointer, size, dispose, closure); }
+
+	/** count of recorded descriptions */
+	unsigned count() const noexcept
+		{ return index_; }
+
+	/** create the data of the dataset */
+	void build(data_array<count_> &result)
+		{ if (index_ != count_)
+			throw create_data_error("create-data-failed");
+		  index_ = 0;
+		  if (afb_create_data_array(count_, result.array_, descs_) < 0)
+			throw create_data_error("create-data-failed");
+		  result.size_ = count_; }
+};
+#endif
+
 /**
  * class intended to manage received set of data: params,
  * and asynchronous replies
@@ -560,6 +1154,209 @@ public:
 	}
 };
 
+/*************************************************************************/
+/* borrowed views of the data of a request                               */
+/*************************************************************************/
+
+/**
+ * scope of validity of views, i.e. the execution of a verb callback
+ *
+ * Verbs whose callback receives an afb::params_view are run within
+ * a scope. Other callbacks have to declare their own scope on stack
+ * before creating views.
+ *
+ * Views record the scope that created them. When the macro
+ * AFB_BINDING_CHECK_VIEWS is set to 1 before including this file,
+ * views check, on each access and at destruction, that their scope
+ * is still running on the current thread and abort otherwise. The
+ * layout of the classes does not depend on that setting.
+ */
+class view_scope
+{
+	/** the enclosing scope */
+	const view_scope *previous_;
+
+	/** serial number of the scope */
+	unsigned long serial_;
+
+	static const view_scope *&current() noexcept
+		{ static thread_local const view_scope *cur = nullptr; return cur; }
+
+	static unsigned long next_serial() noexcept
+		{ static thread_local unsigned long serial = 0; return ++serial; }
+
+public:
+	view_scope() noexcept
+		: previous_{current()}, serial_{next_serial()}
+		{ current() = this; }
+
+	~view_scope()
+		{ current() = previous_; }
+
+	view_scope(const view_scope &) = delete;
+	view_scope &operator=(const view_scope &) = delete;
+
+	/** the innermost running scope of the thread */
+	static const view_scope *innermost() noexcept
+		{ return current(); }
+
+	/** serial number of the scope */
+	unsigned long serial() const noexcept
+		{ return serial_; }
+
+	/** check if the scope of given serial is running */
+	static bool is_running(const view_scope *scope, unsigned long serial) noexcept
+		{ const view_scope *it = current();
+		  while (it != nullptr && it != scope)
+			it = it->previous_;
+		  return it != nullptr && it->serial_ == serial; }
+};
+
+/**
+ * record of the scope of a view, checking it is still running
+ */
+class view_guard
+{
+	const view_scope *scope_;
+	unsigned long serial_;
+public:
+	view_guard() noexcept
+		: scope_{view_scope::innermost()}
+		, serial_{scope_ == nullptr ? 0 : scope_->serial()}
+		{ check(); }
+
+	void check() const noexcept
+		{
+#if AFB_BINDING_CHECK_VIEWS
+			/* the view is used outside of its scope */
+			if (!view_scope::is_running(scope_, serial_))
+				std::abort();
+#endif
+		}
+};
+
+/**
+ * borrowed view of a data of a request
+ *
+ * The view holds no reference: it is only valid during the callback
+ * that received it. It can be moved but not copied and must not be
+ * kept after the callback returns. Use 'data()' and 'afb::data::addref'
+ * for keeping the data.
+ *
+ * Being move only does not prevent the view from escaping its callback,
+ * for example when moved to a global variable. Such an escape is only
+ * detected when the view is accessed or destroyed, and only when
+ * AFB_BINDING_CHECK_VIEWS is set (see afb::view_scope).
+ */
+class data_view
+{
+	/** the viewed data */
+	afb_data_t data_;
+
+	/** the scope of the view */
+	view_guard guard_;
+
+public:
+	/** creation of the view */
+	explicit data_view(afb_data_t a_data) noexcept
+		: data_{a_data} {}
+
+	/* copy and move */
+	data_view(const data_view &other) = delete;
+	data_view &operator=(const data_view &other) = delete;
+	data_view(data_view &&other) noexcept = default;
+	data_view &operator=(data_view &&other) noexcept = default;
+
+	/** destruction */
+	~data_view()
+		{ guard_.check(); }
+
+	/** the type of the data */
+	afb_type_t type() const noexcept
+		{ guard_.check(); return afb_data_type(data_); }
+
+	/** read only pointer to the value */
+	const void *ro_pointer() const noexcept
+		{ guard_.check(); return afb_data_ro_pointer(data_); }
+
+	/** size of the value */
+	std::size_t size() const noexcept
+		{ guard_.check(); return afb_data_size(data_); }
+
+	/** access to the value as a C string */
+	operator const char *() const noexcept
+		{ return reinterpret_cast<const char*>(ro_pointer()); }
+
+	/** access to the value of predefined type, converted if needed */
+	template <class T>
+	T as() const
+		{ guard_.check(); return typed_data<T>(data_).value(); }
+
+	/** the viewed data, without added reference */
+	afb::data data() const noexcept
+		{ guard_.check(); return afb::data(data_); }
+};
+
+/**
+ * borrowed view of the parameters of a request
+ *
+ * Like data_view, it holds no reference and is only valid during
+ * the callback that received it.
+ */
+class params_view
+{
+	/** count of data */
+	unsigned size_;
+
+	/** array of data */
+	afb_data_t const *array_;
+
+	/** the scope of the view */
+	view_guard guard_;
+
+public:
+	/** creation of the view */
+	params_view(unsigned size, afb_data_t const array[]) noexcept
+		: size_{size}, array_{array} {}
+
+	/* copy and move */
+	params_view(const params_view &other) = delete;
+	params_view &operator=(const params_view &other) = delete;
+	params_view(params_view &&other) noexcept = default;
+	params_view &operator=(params_view &&other) noexcept = default;
+
+	/** destruction */
+	~params_view()
+		{ guard_.check(); }
+
+	/** count of data */
+	unsigned size() const noexcept
+		{ guard_.check(); return size_; }
+
+	/** access the data */
+	data_view operator[](unsigned idx) const noexcept
+		{ guard_.check(); return data_view(array_[idx]); }
+
+	data_view operator[](int idx) const noexcept
+		{ return operator[](unsigned(idx)); }
+
+	data_view at(unsigned idx) const {
+		if (size() <= idx)
+			throw std::out_of_range("out of range");
+		return data_view(array_[idx]);
+	}
+
+	data_view at(int idx) const {
+		if (idx < 0)
+			throw std::out_of_range("out of range");
+		return at(unsigned(idx));
+	}
+
+	/** the viewed data, without added reference */
+	received_data data() const noexcept
+		{ guard_.check(); return received_data(size_, array_); }
+};
+
 /* apis */
 class api : public logger
 {
@@ -653,13 +1450,13 @@ public:
 	int broadcast() const;
 	int broadcast(afb_data_t data) const;
 	int broadcast(unsigned nparams, afb_data_t const params[]) const;
-	template <unsigned n> int broadcast(const dataset<n> &params) const;
+	template <unsigned n> int broadcast(const data_array<n> &params) const;
 	int broadcast(const std::vector<afb_data_t> &&params) const;
 
 	int push() const;
 	int push(afb_data_t data) const;
 	int push(unsigned nparams, afb_data_t const params[]) const;
-	template <unsigned n> int push(const dataset<n> &params) const;
+	template <unsigned n> int push(const data_array<n> &params) const;
 	int push(const std::vector<afb_data_t> &&params) const;
 
 	void unref();
@@ -693,9 +1490,11 @@ public:
 	void reply(int status = 0) const noexcept;
 	void reply(int status, afb_data_t data) const noexcept;
 	void reply(int status, unsigned nreplies, afb_data_t const replies[]) const noexcept;
-	template <unsigned n> void reply(int status, const dataset<n> &replies) const noexcept;
+	template <unsigned n> void reply(int status, const data_array<n> &replies) const noexcept;
 	void reply(int status, received_data replies) const noexcept;
 	void reply(int status, const std::vector<afb_data_t> &&params) const noexcept;
+	void reply(int status, data_ref &&data) const noexcept;
+	template <unsigned n> void reply(int status, data_vector<n> &&replies) const noexcept;
 
 	void addref() const;
 
@@ -804,6 +1603,20 @@ public:
 
 	data convert(int idx, type type) const
 		{ return convert(unsigned(idx), type); }
+
+#if AFB_BINDING_X4R1_ITF_REVISION >= 10
+	/** conversion of the parameter remembered by it, the result is borrowed */
+	data convert_cached(unsigned idx, type type) const
+		{
+			const afb_data_t *params;
+			if (idx >= afb_req_parameters(req_, &params))
+				throw convert_data_error("can't convert parameter");
+			return data(params[idx]).convert_cached(type);
+		}
+
+	data convert_cached(int idx, type type) const
+		{ return convert_cached(unsigned(idx), type); }
+#endif
 };
 
 
@@ -999,13 +1812,13 @@ inline bool event::is_valid() const { return afb_event_is_valid(event_); }
 inline int event::broadcast() const { return afb_event_broadcast(event_, 0, nullptr); }
 inline int event::broadcast(afb_data_t data) const { return afb_event_broadcast(event_, 1, &data); }
 inline int event::broadcast(unsigned nparams, afb_data_t const params[]) const { return afb_event_broadcast(event_, nparams, params); }
-template <unsigned n> int event::broadcast(const dataset<n> &params) const { return broadcast(params.count(), params.data()); }
+template <unsigned n> int event::broadcast(const data_array<n> &params) const { return broadcast(params.count(), params.data()); }
 inline int event::broadcast(const std::vector<afb_data_t> &&params) const { return broadcast((unsigned)params.size(), params.data()); }
 
 inline int event::push() const { return afb_event_push(event_, 0, nullptr); }
 inline int event::push(afb_data_t data) const { return afb_event_push(event_, 1, &data); }
 inline int event::push(unsigned nparams, afb_data_t const params[]) const { return afb_event_push(event_, nparams, params); }
-template <unsigned n> int event::push(const dataset<n> &params) const { return push(params.count(), params.data()); }
+template <unsigned n> int event::push(const data_array<n> &params) const { return push(params.count(), params.data()); }
 inline int event::push(const std::vector<afb_data_t> &&params) const { return push((unsigned)params.size(), params.data()); }
 
 inline void event::unref() { if (event_) afb_event_unref(event_); event_ = nullptr; }
@@ -1041,7 +1854,7 @@ inline void req::reply(int status, afb_data_t data) const noexcept
 
 inline void req::reply(int status, unsigned nreplies, afb_data_t const replies[]) const noexcept
 	{ afb_req_reply(req_, status, nreplies, replies); }
-template <unsigned n> void req::reply(int status, const dataset<n> &replies) const noexcept
+template <unsigned n> void req::reply(int status, const data_array<n> &replies) const noexcept
 	{ afb_req_reply(req_, status, replies.count(), replies.data()); }
 inline void req::reply(int status, received_data replies) const noexcept
 	{
@@ -1051,6 +1864,12 @@ inline void req::reply(int status, received_data replies) const noexcept
 
 inline void req::reply(int status, const std::vector<afb_data_t> &&replies) const noexcept
 	{ reply(status, (unsigned)replies.size(), replies.data()); }
+inline void req::reply(int status, data_ref &&data) const noexcept
+	{ afb_data_t item = data.release();
+	  afb_req_reply(req_, status, item != nullptr, &item); }
+template <unsigned n> void req::reply(int status, data_vector<n> &&replies) const noexcept
+	{ afb_req_reply(req_, status, replies.size(), replies.data());
+	  replies.forget(); }
 
 inline void req::addref() const { afb_req_addref(req_); }
 
@@ -1273,6 +2092,19 @@ void verbcb(afb_req_t req, unsigned nparams, afb_data_t const params[])
 	}
 }
 
+template <void (*_F_)(afb::req,afb::params_view)>
+void verbcb(afb_req_t req, unsigned nparams, afb_data_t const params[])
+{
+	try {
+		afb::view_scope scope;
+		_F_(afb::req(req), afb::params_view(nparams, params));
+	}
+	catch (std::exception &e) {
+		AFB_REQ_ERROR(req, "Exception %s", e.what());
+		afb_req_reply(req, AFB_ERRNO_INTERNAL_ERROR, 0, nullptr);
+	}
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <class _C_, void (_C_::*_F_)(afb::req,afb::received_data)>
@@ -1354,6 +2186,19 @@ constexpr afb_verb_t verb(
 	return { name, verbcb<_F_>, auth, info, vcbdata, session, glob };
 }
 
+template <void (*_F_)(afb::req,afb::params_view)>
+constexpr afb_verb_t verb(
+	const char *name,
+	const char *info = nullptr,
+	uint16_t session = 0,
+	const afb_auth *auth = nullptr,
+	bool glob = false,
+	void *vcbdata = nullptr
+)
+{
+	return { name, verbcb<_F_>, auth, info, vcbdata, session, glob };
+}
+
 /*
 template <class _C_, void (_C_::*_F_)(afb::req,afb::received_data)>
 constexpr afb_verb_t verb_client(
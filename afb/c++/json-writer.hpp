@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2015-2026 IoT.bzh Company
+ * Author: José Bollo <jose.bollo@iot.bzh>
+ *
+ * SPDX-License-Identifier: LGPL-3.0-only
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "binding"
+
+extern "C" {
+#include <afb/afb-json-writer.h>
+}
+
+namespace afb {
+
+/**
+ * class writing JSON text directly in a data of type JSON
+ *
+ * ```c++
+ * afb::json_writer w;
+ * w.begin_object().key("count").value(10).end_object();
+ * req.reply(0, w.take());
+ * ```
+ */
+class json_writer
+{
+	/** the C writer */
+	afb_json_writer_t writer_;
+
+public:
+	/** default constructor */
+	json_writer() noexcept
+		{ afb_json_writer_init(&writer_); }
+
+	/* copy and move */
+	json_writer(const json_writer &other) = delete;
+	json_writer &operator=(const json_writer &other) = delete;
+	json_writer(json_writer &&other) noexcept
+		: writer_(other.writer_) { afb_json_writer_init(&other.writer_); }
+
+	/** destruction */
+	~json_writer()
+		{ afb_json_writer_release(&writer_); }
+
+	/** structure */
+	json_writer &begin_object() noexcept
+		{ afb_json_writer_begin_object(&writer_); return *this; }
+	json_writer &end_object() noexcept
+		{ afb_json_writer_end_object(&writer_); return *this; }
+	json_writer &begin_array() noexcept
+		{ afb_json_writer_begin_array(&writer_); return *this; }
+	json_writer &end_array() noexcept
+		{ afb_json_writer_end_array(&writer_); return *this; }
+	json_writer &key(const char *key) noexcept
+		{ afb_json_writer_key(&writer_, key); return *this; }
+	json_writer &key(const std::string &key) noexcept
+		{ return this->key(key.c_str()); }
+
+	/** values */
+	json_writer &null() noexcept
+		{ afb_json_writer_null(&writer_); return *this; }
+	json_writer &value(bool value) noexcept
+		{ afb_json_writer_bool(&writer_, value); return *this; }
+	json_writer &value(int value) noexcept
+		{ afb_json_writer_int(&writer_, value); return *this; }
+	json_writer &value(long value) noexcept
+		{ afb_json_writer_int(&writer_, value); return *this; }
+	json_writer &value(long long value) noexcept
+		{ afb_json_writer_int(&writer_, value); return *this; }
+	json_writer &value(unsigned value) noexcept
+		{ afb_json_writer_uint(&writer_, value); return *this; }
+	json_writer &value(unsigned long value) noexcept
+		{ afb_json_writer_uint(&writer_, value); return *this; }
+	json_writer &value(unsigned long long value) noexcept
+		{ afb_json_writer_uint(&writer_, value); return *this; }
+	json_writer &value(double value) noexcept
+		{ afb_json_writer_double(&writer_, value); return *this; }
+	json_writer &value(const char *value) noexcept
+		{ afb_json_writer_string(&writer_, value); return *this; }
+	json_writer &value(const std::string &value) noexcept
+		{ afb_json_writer_string_len(&writer_, value.data(), value.size()); return *this; }
+	json_writer &raw(const char *json, size_t length) noexcept
+		{ afb_json_writer_raw(&writer_, json, length); return *this; }
+
+	/** status */
+	int error() const noexcept
+		{ return afb_json_writer_error(&writer_); }
+
+	/** the text written, owned by the writer */
+	const char *text() noexcept
+		{ return afb_json_writer_text(&writer_, nullptr); }
+
+	/** get the text as a JSON data, the writer restarts empty */
+	data_ref take()
+		{ afb_data_t data;
+		  if (afb_json_writer_to_data(&writer_, &data) < 0)
+			throw create_data_error("create-data-failed");
+		  return data_ref::adopt(data); }
+};
+
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2015-2026 IoT.bzh Company
+ * Author: José Bollo <jose.bollo@iot.bzh>
+ *
+ * SPDX-License-Identifier: LGPL-3.0-only
+ */
+/*
+ * Micro benchmark comparing the conversion of arrays of data
+ * item by item (as done by afb_data_array_convert before
+ * revision 10) with the conversion at once by the binder.
+ *
+ * Usage: bench-convert convert [COUNT [LOOPS]]
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+
+#define AFB_BINDING_VERSION 4
+#define AFB_BINDING_X4R1_ITF_REVISION 10
+#include <afb/afb-binding.h>
+
+#include "tuto-helpers.h"
+
+#define MAXCOUNT 256
+
+/* conversion item by item */
+static int convert_loop(
+	unsigned count,
+	afb_data_t const * array_data,
+	afb_type_t const * array_type,
+	afb_data_t *array_result
+) {
+	int rc = 0;
+	unsigned index = 0;
+
+	while (rc >= 0 && index < count) {
+		rc = afb_data_convert(array_data[index], array_type[index], &array_result[index]);
+		if (rc >= 0)
+			index++;
+		else {
+			while (index)
+				afb_data_unref(array_result[--index]);
+			while (index < count)
+				array_result[index++] = 0;
+		}
+	}
+	return rc;
+}
+
+/* the conversion to measure */
+struct conversion
+{
+	int (*convert)(unsigned, afb_data_t const*, afb_type_t const*, afb_data_t*);
+	unsigned count;
+	afb_data_t const *data;
+	afb_type_t const *types;
+};
+
+/* run the conversion once */
+static int run_conversion(void *closure)
+{
+	struct conversion *conv = closure;
+	afb_data_t converted[MAXCOUNT];
+	int rc = conv->convert(conv->count, conv->data, conv->types, converted);
+	if (rc >= 0)
+		afb_data_array_unref(conv->count, converted);
+	return rc;
+}
+
+static void convert(afb_req_t req, unsigned nparams, afb_data_t const *params)
+{
+	int rc, loops;
+	int32_t values[MAXCOUNT];
+	unsigned idx, count;
+	afb_data_t data[MAXCOUNT];
+	afb_type_t types[MAXCOUNT];
+	double loopns, arrayns;
+	struct conversion conv;
+
+	count = (unsigned)get_param(req, nparams, 0, 16);
+	loops = get_param(req, nparams, 1, 10000);
+	if (count == 0 || count > MAXCOUNT || loops <= 0) {
+		afb_req_reply(req, AFB_ERRNO_INVALID_REQUEST, 0, NULL);
+		return;
+	}
+
+	/* volatile data are not cached, so each loop really converts */
+	for (idx = 0 ; idx < count ; idx++) {
+		values[idx] = (int32_t)idx;
+		rc = afb_create_data_raw(&data[idx], AFB_PREDEFINED_TYPE_I32, &values[idx], sizeof values[idx], NULL, NULL);
+		if (rc < 0) {
+			afb_data_array_unref(idx, data);
+			afb_req_reply(req, rc, 0, NULL);
+			return;
+		}
+		afb_data_set_volatile(data[idx]);
+		types[idx] = AFB_PREDEFINED_TYPE_JSON;
+	}
+
+	conv.count = count;
+	conv.data = data;
+	conv.types = types;
+	conv.convert = convert_loop;
+	rc = measure(run_conversion, &conv, loops, &loopns);
+	if (rc >= 0) {
+		conv.convert = afb_data_array_convert;
+		rc = measure(run_conversion, &conv, loops, &arrayns);
+	}
+	afb_data_array_unref(count, data);
+	if (rc < 0) {
+		afb_req_reply(req, rc, 0, NULL);
+		return;
+	}
+
+	reply_text(req, 0, "count %u, loops %d: item by item %.1f ns/item, at once %.1f ns/item",
+			count, loops, loopns / count, arrayns / count);
+}
+
+const afb_verb_t verbs[] = {
+	{ .verb="convert", .callback=convert },
+	{ .verb=NULL }
+};
+
+const afb_binding_t afbBindingExport = {
+	.api = "bench-convert",
+	.verbs = verbs
+};
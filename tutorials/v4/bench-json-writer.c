@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2015-2026 IoT.bzh Company
+ * Author: José Bollo <jose.bollo@iot.bzh>
+ *
+ * SPDX-License-Identifier: LGPL-3.0-only
+ */
+/*
+ * Micro benchmark comparing the creation of a JSON reply listing
+ * many items using a tree of json-c objects serialised to text
+ * with the direct writing of the text using afb-json-writer.h.
+ *
+ * Usage: bench-json-writer list [COUNT [LOOPS]]
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <json-c/json.h>
+
+#define AFB_BINDING_VERSION 4
+#define AFB_BINDING_X4R1_ITF_REVISION 7
+#include <afb/afb-binding.h>
+#include <afb/afb-json-writer.h>
+
+#include "tuto-helpers.h"
+
+#define MAXCOUNT 1000000
+
+/* creation of the list using json-c */
+static int list_json_c(unsigned count, afb_data_t *result)
+{
+	unsigned idx;
+	char name[32];
+	const char *text;
+	size_t length;
+	int rc;
+	json_object *list, *item;
+
+	list = json_object_new_array();
+	for (idx = 0 ; idx < count ; idx++) {
+		snprintf(name, sizeof name, "item-%u", idx);
+		item = json_object_new_object();
+		json_object_object_add(item, "index", json_object_new_int64(idx));
+		json_object_object_add(item, "name", json_object_new_string(name));
+		json_object_object_add(item, "value", json_object_new_double(idx * 0.5));
+		json_object_array_add(list, item);
+	}
+	text = json_object_to_json_string_length(list, JSON_C_TO_STRING_PLAIN, &length);
+	rc = afb_create_data_copy(result, AFB_PREDEFINED_TYPE_JSON, text, length + 1);
+	json_object_put(list);
+	return rc;
+}
+
+/* creation of the list using the writer */
+static int list_writer(unsigned count, afb_data_t *result)
+{
+	unsigned idx;
+	char name[32];
+	afb_json_writer_t writer;
+
+	afb_json_writer_init(&writer);
+	afb_json_writer_begin_array(&writer);
+	for (idx = 0 ; idx < count ; idx++) {
+		snprintf(name, sizeof name, "item-%u", idx);
+		afb_json_writer_begin_object(&writer);
+		afb_json_writer_key(&writer, "index");
+		afb_json_writer_int(&writer, idx);
+		afb_json_writer_key(&writer, "name");
+		afb_json_writer_string(&writer, name);
+		afb_json_writer_key(&writer, "value");
+		afb_json_writer_double(&writer, idx * 0.5);
+		afb_json_writer_end_object(&writer);
+	}
+	afb_json_writer_end_array(&writer);
+	return afb_json_writer_to_data(&writer, result);
+}
+
+/* the creation to measure */
+struct creation
+{
+	int (*create)(unsigned, afb_data_t*);
+	unsigned count;
+};
+
+/* run the creation once */
+static int run_creation(void *closure)
+{
+	struct creation *creation = closure;
+	afb_data_t data;
+	int rc = creation->create(creation->count, &data);
+	if (rc >= 0)
+		afb_data_unref(data);
+	return rc;
+}
+
+static void list(afb_req_t req, unsigned nparams, afb_data_t const *params)
+{
+	int rc, count, loops;
+	double jsoncns, writerns;
+	struct creation creation;
+
+	count = get_param(req, nparams, 0, 10000);
+	loops = get_param(req, nparams, 1, 10);
+	if (count <= 0 || count > MAXCOUNT || loops <= 0) {
+		afb_req_reply(req, AFB_ERRNO_INVALID_REQUEST, 0, NULL);
+		return;
+	}
+
+	creation.count = (unsigned)count;
+	creation.create = list_json_c;
+	rc = measure(run_creation, &creation, loops, &jsoncns);
+	if (rc >= 0) {
+		creation.create = list_writer;
+		rc = measure(run_creation, &creation, loops, &writerns);
+	}
+	if (rc < 0) {
+		afb_req_reply(req, rc, 0, NULL);
+		return;
+	}
+
+	reply_text(req, 0, "count %d, loops %d: json-c %.1f us/list, writer %.1f us/list",
+			count, loops, jsoncns / 1e3, writerns / 1e3);
+}
+
+const afb_verb_t verbs[] = {
+	{ .verb="list", .callback=list },
+	{ .verb=NULL }
+};
+
+const afb_binding_t afbBindingExport = {
+	.api = "bench-json-writer",
+	.verbs = verbs
+};
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2015-2026 IoT.bzh Company
+ * Author: José Bollo <jose.bollo@iot.bzh>
+ *
+ * SPDX-License-Identifier: LGPL-3.0-only
+ */
+/*
+ * Micro benchmark comparing the conversion of arrays of doubles
+ * to and from JSON using a tree of json-c objects with the predefined
+ * converters of the type AFB_PREDEFINED_TYPE_F64_ARRAY.
+ *
+ * Usage: bench-number-arrays f64 [COUNT [LOOPS]]
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <json-c/json.h>
+
+#define AFB_BINDING_VERSION 4
+#define AFB_BINDING_X4R1_ITF_REVISION 10
+#include <afb/afb-binding.h>
+
+#include "tuto-helpers.h"
+
+#define MAXCOUNT 10000000
+
+/* writing of the JSON array using json-c */
+static int write_json_c(afb_data_t array, afb_data_t *result)
+{
+	const double *values = afb_data_ro_pointer(array);
+	size_t idx, count = afb_data_size(array) / sizeof *values, length;
+	const char *text;
+	int rc;
+	json_object *list;
+
+	list = json_object_new_array();
+	for (idx = 0 ; idx < count ; idx++)
+		json_object_array_add(list, json_object_new_double(values[idx]));
+	text = json_object_to_json_string_length(list, JSON_C_TO_STRING_PLAIN, &length);
+	rc = afb_create_data_copy(result, AFB_PREDEFINED_TYPE_JSON, text, length + 1);
+	json_object_put(list);
+	return rc;
+}
+
+/* writing of the JSON array using the predefined converter */
+static int write_predefined(afb_data_t array, afb_data_t *result)
+{
+	return afb_data_convert(array, AFB_PREDEFINED_TYPE_JSON, result);
+}
+
+/* reading of the JSON array using json-c */
+static int read_json_c(afb_data_t json, afb_data_t *result)
+{
+	size_t idx, count;
+	double *values;
+	int rc;
+	json_object *list;
+
+	list = json_tokener_parse(afb_data_ro_pointer(json));
+	if (!json_object_is_type(list, json_type_array))
+		rc = AFB_ERRNO_INVALID_REQUEST;
+	else {
+		count = json_object_array_length(list);
+		rc = afb_create_data_alloc(result, AFB_PREDEFINED_TYPE_F64_ARRAY,
+					(void**)&values, count * sizeof *values);
+		for (idx = 0 ; rc >= 0 && idx < count ; idx++)
+			values[idx] = json_object_get_double(json_object_array_get_idx(list, idx));
+	}
+	json_object_put(list);
+	return rc;
+}
+
+/* reading of the JSON array using the predefined converter */
+static int read_predefined(afb_data_t json, afb_data_t *result)
+{
+	return afb_data_convert(json, AFB_PREDEFINED_TYPE_F64_ARRAY, result);
+}
+
+/* the conversion to measure */
+struct conversion
+{
+	int (*convert)(afb_data_t, afb_data_t*);
+	afb_data_t data;
+};
+
+/* run the conversion once */
+static int run_conversion(void *closure)
+{
+	struct conversion *conv = closure;
+	afb_data_t converted;
+	int rc = conv->convert(conv->data, &converted);
+	if (rc >= 0)
+		afb_data_unref(converted);
+	return rc;
+}
+
+/* measure the conversion, result in millions of values per second */
+static int throughput(
+	int (*convert)(afb_data_t, afb_data_t*),
+	afb_data_t data,
+	size_t count,
+	int loops,
+	double *result
+) {
+	struct conversion conv = { .convert = convert, .data = data };
+	int rc = measure(run_conversion, &conv, loops, result);
+	if (rc >= 0)
+		*result = (double)count * 1e3 / *result;
+	return rc;
+}
+
+static void f64(afb_req_t req, unsigned nparams, afb_data_t const *params)
+{
+	int rc, count, loops, idx;
+	afb_data_t array, json;
+	double *values, wjsonc, wpredef, rjsonc, rpredef;
+
+	count = get_param(req, nparams, 0, 1000000);
+	loops = get_param(req, nparams, 1, 3);
+	if (count <= 0 || count > MAXCOUNT || loops <= 0) {
+		afb_req_reply(req, AFB_ERRNO_INVALID_REQUEST, 0, NULL);
+		return;
+	}
+
+	/* the samples */
+	rc = afb_create_data_alloc(&array, AFB_PREDEFINED_TYPE_F64_ARRAY,
+				(void**)&values, (size_t)count * sizeof *values);
+	if (rc < 0) {
+		afb_req_reply(req, rc, 0, NULL);
+		return;
+	}
+	for (idx = 0 ; idx < count ; idx++)
+		values[idx] = (double)idx * 0.001 - 500.0;
+
+	/* volatile data are not cached, so each loop really converts */
+	afb_data_set_volatile(array);
+
+	rc = throughput(write_json_c, array, (size_t)count, loops, &wjsonc);
+	if (rc >= 0)
+		rc = throughput(write_predefined, array, (size_t)count, loops, &wpredef);
+	if (rc >= 0) {
+		rc = write_predefined(array, &json);
+		if (rc >= 0) {
+			afb_data_set_volatile(json);
+			rc = throughput(read_json_c, json, (size_t)count, loops, &rjsonc);
+			if (rc >= 0)
+				rc = throughput(read_predefined, json, (size_t)count, loops, &rpredef);
+			afb_data_unref(json);
+		}
+	}
+	afb_data_unref(array);
+	if (rc < 0) {
+		afb_req_reply(req, rc, 0, NULL);
+		return;
+	}
+
+	reply_text(req, 0, "count %d, loops %d, Mvalues/s: write json-c %.1f, predefined %.1f;"
+				" read json-c %.1f, predefined %.1f",
+			count, loops, wjsonc, wpredef, rjsonc, rpredef);
+}
+
+const afb_verb_t verbs[] = {
+	{ .verb="f64", .callback=f64 },
+	{ .verb=NULL }
+};
+
+const afb_binding_t afbBindingExport = {
+	.api = "bench-number-arrays",
+	.verbs = verbs
+};
@@ -0,0 +1,64 @@
+// Copyright (C) 2015-2026 IoT.bzh Company
+// Author: José Bollo <jose.bollo@iot.bzh>
+//
+// SPDX-License-Identifier: LGPL-3.0-only
+
+// Micro benchmark comparing the resolution of a type by its name
+// at each use with the resolution memorised using AFB_TYPE.
+//
+// Usage: bench-type-lookup lookup [LOOPS]
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#define AFB_BINDING_VERSION 4
+#define AFB_BINDING_X4R1_ITF_REVISION 10
+#include <afb/afb-binding>
+
+static afb_type_t mytype;
+
+template <class F>
+static double measure(int loops, F &&fun)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (int iter = 0 ; iter < loops ; iter++)
+		fun();
+	auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(stop - start).count() / loops;
+}
+
+void lookup(afb::req req, afb::received_data params)
+{
+	int loops = 1000000;
+	if (params.size() > 0 && req.try_convert(0, afb::I32()))
+		loops = *static_cast<const int32_t*>(*params[0]);
+	if (loops <= 0) {
+		req.reply(AFB_ERRNO_INVALID_REQUEST);
+		return;
+	}
+
+	unsigned found = 0;
+	double byname = measure(loops, [&found]() { found += afb_type_t(afb::type("mytype")) == mytype; });
+	double memo = measure(loops, [&found]() { found += afb_type_t(AFB_TYPE("mytype")) == mytype; });
+
+	char text[128];
+	int len = snprintf(text, sizeof text, "loops %d: by name %.1f ns, memorised %.1f ns, %s",
+			loops, byname, memo, found == 2 * unsigned(loops) ? "success" : "failure");
+	req.reply(0, afb::data(afb::STRINGZ(), text, 1 + size_t(len)));
+}
+
+int mainctl(afb::api api, afb::ctlid ctlid, const afb::ctlarg ctlarg, void *userdata) noexcept
+{
+	if (ctlid == afb_ctlid_Init)
+		return afb_type_register(&mytype, "mytype", Afb_Type_Flags_Shareable);
+	return 0;
+}
+
+const afb_verb_t verbs[] = {
+	afb::verb<lookup>("lookup", "time the resolution of types by name"),
+	afb::verbend()
+};
+
+const afb_binding_t afbBindingExport =
+	afb::binding<mainctl>("bench-type-lookup", verbs, "benchmark of type lookups");
@@ -0,0 +1,98 @@
+// Copyright (C) 2015-2026 IoT.bzh Company
+// Author: José Bollo <jose.bollo@iot.bzh>
+//
+// SPDX-License-Identifier: LGPL-3.0-only
+
+// Watching the changes of a data: a counter shared by all the
+// clients is watched and each change is pushed to the subscribed
+// clients, so they don't have to poll the counter.
+//
+// Usage: data-watch subscribe
+//        data-watch increment
+//        data-watch get
+
+#define AFB_BINDING_VERSION 4
+#define AFB_BINDING_X4R1_ITF_REVISION 10
+#include <afb/afb-binding>
+
+// the watched counter and the event of its changes
+static afb::data counter;
+static afb::event changed;
+
+// a new data holding the current value of the counter, so that
+// the clients receive a value that is not changed afterward
+static afb::data snapshot(afb::data data)
+{
+	int32_t value;
+
+	afb_data_lock_read(data);
+	value = *static_cast<const int32_t*>(afb_data_ro_pointer(data));
+	afb_data_unlock(data);
+	return afb::data::of(value);
+}
+
+// called by the thread that changed the counter, after its unlock
+static void on_change(afb::event *event, afb::data data)
+{
+	try {
+		event->push(snapshot(data));
+	}
+	catch (const afb::error &) {
+		// no memory for the snapshot, the change is not pushed
+	}
+}
+
+void subscribe(afb::req req, afb::received_data params)
+{
+	req.reply(req.subscribe(changed) ? 0 : AFB_ERRNO_INTERNAL_ERROR);
+}
+
+void increment(afb::req req, afb::received_data params)
+{
+	int32_t value;
+
+	// the watchers are notified once, when the counter is unlocked
+	afb_data_lock_write(counter);
+	value = ++*static_cast<int32_t*>(afb_data_ro_pointer(counter));
+	afb_data_unlock(counter);
+	req.reply(0, afb::data::of(value));
+}
+
+void get(afb::req req, afb::received_data params)
+{
+	req.reply(0, snapshot(counter));
+}
+
+int mainctl(afb::api api, afb::ctlid ctlid, const afb::ctlarg ctlarg, void *userdata) noexcept
+{
+	if (ctlid == afb_ctlid_Init) {
+		afb_data_t data;
+		void *pointer;
+
+		changed = api.new_event("changed");
+		if (!changed.is_valid()
+		 || afb_create_data_alloc(&data, afb::I32(), &pointer, sizeof(int32_t)) < 0)
+			return AFB_ERRNO_OUT_OF_MEMORY;
+		*static_cast<int32_t*>(pointer) = 0;
+
+		// the counter is kept until the end of the binding
+		counter = data;
+		try {
+			counter.watch<afb::event, on_change>(&changed);
+		}
+		catch (const afb::error &) {
+			return AFB_ERRNO_INTERNAL_ERROR;
+		}
+	}
+	return 0;
+}
+
+const afb_verb_t verbs[] = {
+	afb::verb<subscribe>("subscribe", "subscribe to the changes of the counter"),
+	afb::verb<increment>("increment", "increment the counter"),
+	afb::verb<get>("get", "get the counter"),
+	afb::verbend()
+};
+
+const afb_binding_t afbBindingExport =
+	afb::binding<mainctl>("data-watch", verbs, "watching the changes of a data");
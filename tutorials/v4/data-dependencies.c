@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2015-2026 IoT.bzh Company
+ * Author: José Bollo <jose.bollo@iot.bzh>
+ *
+ * SPDX-License-Identifier: LGPL-3.0-only
+ */
+/*
+ * Test of the dependencies of data: it builds a tree of data
+ * where each node depends on its children, inspects it and checks
+ * that releasing the root releases the whole tree at once.
+ *
+ * Usage: data-dependencies tree [WIDTH [DEPTH]]
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+
+#define AFB_BINDING_VERSION 4
+#define AFB_BINDING_X4R1_ITF_REVISION 10
+#include <afb/afb-binding.h>
+
+#include "tuto-helpers.h"
+
+#define MAXWIDTH 16
+#define MAXDEPTH 8
+#define MAXNODES 100000
+
+/* value shared by all the nodes */
+static const char payload[16] = "dependency-node";
+
+/* count of released nodes, verbs are not run concurrently here */
+static unsigned released;
+
+static void on_release(void *closure)
+{
+	released++;
+}
+
+/* create a node */
+static int create_node(afb_data_t *node)
+{
+	return afb_create_data_raw(node, AFB_PREDEFINED_TYPE_BYTEARRAY,
+				payload, sizeof payload, on_release, NULL);
+}
+
+/* add to parent a subtree of given width and depth, count the created nodes */
+static int add_children(afb_data_t parent, unsigned width, unsigned depth, unsigned *count)
+{
+	int rc = 0;
+	unsigned idx;
+	afb_data_t child;
+
+	for (idx = 0 ; rc >= 0 && depth > 0 && idx < width ; idx++) {
+		rc = create_node(&child);
+		if (rc >= 0) {
+			++*count;
+			rc = afb_data_dependency_add(parent, child);
+			if (rc >= 0)
+				rc = add_children(child, width, depth - 1, count);
+			/* the child is now kept by its parent */
+			afb_data_unref(child);
+		}
+	}
+	return rc;
+}
+
+/* callback of the enumeration of dependencies */
+static int count_direct(void *closure, afb_data_t dependency)
+{
+	unsigned *count = closure;
+	++*count;
+	return 0;
+}
+
+/* count of nodes of a tree of given width and depth */
+static unsigned count_nodes(unsigned width, unsigned depth)
+{
+	unsigned level = 1, nodes = 1;
+
+	while (depth-- > 0 && nodes <= MAXNODES) {
+		level *= width;
+		nodes += level;
+	}
+	return nodes;
+}
+
+static void tree(afb_req_t req, unsigned nparams, afb_data_t const *params)
+{
+	int rc, width, depth;
+	unsigned count, direct, expected;
+	afb_data_t root;
+	afb_data_dependency_stats_t stats;
+
+	width = get_param(req, nparams, 0, 3);
+	depth = get_param(req, nparams, 1, 4);
+	if (width <= 0 || width > MAXWIDTH || depth <= 0 || depth > MAXDEPTH
+	 || count_nodes((unsigned)width, (unsigned)depth) > MAXNODES) {
+		afb_req_reply(req, AFB_ERRNO_INVALID_REQUEST, 0, NULL);
+		return;
+	}
+
+	/* build the tree */
+	count = 0;
+	rc = create_node(&root);
+	if (rc >= 0) {
+		rc = add_children(root, (unsigned)width, (unsigned)depth, &count);
+		if (rc >= 0)
+			rc = afb_data_dependency_stats(root, &stats);
+		if (rc >= 0) {
+			direct = 0;
+			rc = afb_data_dependency_foreach(root, count_direct, &direct);
+		}
+		/* release the root and so the tree */
+		released = 0;
+		afb_data_unref(root);
+	}
+	if (rc < 0) {
+		afb_req_reply(req, rc, 0, NULL);
+		return;
+	}
+
+	/* check the counters */
+	expected = count + 1;
+	rc = stats.direct == direct && direct == (unsigned)width
+	  && stats.total == count && stats.depth == (unsigned)depth
+	  && stats.retained_bytes == count * sizeof payload
+	  && released == expected ? 0 : AFB_ERRNO_INTERNAL_ERROR;
+
+	reply_text(req, rc, "%s: %u nodes, depth %u, %u direct, %llu bytes retained, %u of %u released",
+			rc == 0 ? "success" : "failure",
+			(unsigned)stats.total, (unsigned)stats.depth, direct,
+			(unsigned long long)stats.retained_bytes, released, expected);
+}
+
+const afb_verb_t verbs[] = {
+	{ .verb="tree", .callback=tree },
+	{ .verb=NULL }
+};
+
+const afb_binding_t afbBindingExport = {
+	.api = "data-dependencies",
+	.verbs = verbs
+};
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2015-2026 IoT.bzh Company
+ * Author: José Bollo <jose.bollo@iot.bzh>
+ *
+ * SPDX-License-Identifier: LGPL-3.0-only
+ */
+/*
+ * Serving files without copying them: the file is mapped in
+ * memory by afb_create_data_mmap and the mapped data is given as
+ * is to afb_req_reply. The binder sends it to the client, for
+ * HTTP clients as body of the HTTP reply, and unmaps the file
+ * when the data is released.
+ *
+ * Usage: serve-file get PATH
+ *
+ * PATH is relative to the current directory of the binder and
+ * can not contain "..".
+ */
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#define AFB_BINDING_VERSION 4
+#define AFB_BINDING_X4R1_ITF_REVISION 10
+#include <afb/afb-binding.h>
+
+static void get(afb_req_t req, unsigned nparams, afb_data_t const *params)
+{
+	int rc, fd;
+	const char *path;
+	afb_data_t arg, data;
+
+	/* get the path */
+	if (nparams < 1 || afb_req_param_convert(req, 0, AFB_PREDEFINED_TYPE_STRINGZ, &arg) < 0) {
+		afb_req_reply(req, AFB_ERRNO_INVALID_REQUEST, 0, NULL);
+		return;
+	}
+	path = afb_data_ro_pointer(arg);
+	if (path == NULL || path[0] == 0 || path[0] == '/' || strstr(path, "..") != NULL) {
+		afb_req_reply(req, AFB_ERRNO_INVALID_REQUEST, 0, NULL);
+		return;
+	}
+
+	/* map the file, it can be closed after */
+	fd = open(path, O_RDONLY|O_CLOEXEC);
+	if (fd < 0) {
+		afb_req_reply(req, AFB_ERRNO_NOT_AVAILABLE, 0, NULL);
+		return;
+	}
+	rc = afb_create_data_mmap(&data, AFB_PREDEFINED_TYPE_BYTEARRAY, fd, 0, 0);
+	close(fd);
+	if (rc < 0) {
+		afb_req_reply(req, rc, 0, NULL);
+		return;
+	}
+
+	/* the reply takes the data, the file is never copied */
+	afb_req_reply(req, 0, 1, &data);
+}
+
+const afb_verb_t verbs[] = {
+	{ .verb="get", .callback=get },
+	{ .verb=NULL }
+};
+
+const afb_binding_t afbBindingExport = {
+	.api = "serve-file",
+	.verbs = verbs
+};
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2015-2026 IoT.bzh Company
+ * Author: José Bollo <jose.bollo@iot.bzh>
+ *
+ * SPDX-License-Identifier: LGPL-3.0-only
+ */
+/*
+ * Helpers shared by the benchmark and test tutorials.
+ *
+ * This file is included after afb/afb-binding.h by tutorials
+ * defining _GNU_SOURCE.
+ */
+#pragma once
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* get the integer parameter of index or the default value */
+static inline
+int
+get_param(
+	afb_req_t req,
+	unsigned nparams,
+	unsigned index,
+	int defval
+) {
+	afb_data_t data;
+
+	if (index >= nparams || afb_req_param_convert(req, index, AFB_PREDEFINED_TYPE_I32, &data) < 0)
+		return defval;
+	return *(const int32_t*)afb_data_ro_pointer(data);
+}
+
+/* elapsed nanoseconds */
+static inline
+double
+elapsed_ns(
+	const struct timespec *start,
+	const struct timespec *stop
+) {
+	return (double)(stop->tv_sec - start->tv_sec) * 1e9
+	     + (double)(stop->tv_nsec - start->tv_nsec);
+}
+
+/* call 'loops' times run(closure), store the mean nanoseconds of a call */
+static inline
+int
+measure(
+	int (*run)(void *closure),
+	void *closure,
+	int loops,
+	double *result
+) {
+	int rc, iter;
+	struct timespec start, stop;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (iter = 0 ; iter < loops ; iter++) {
+		rc = run(closure);
+		if (rc < 0)
+			return rc;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+	*result = elapsed_ns(&start, &stop) / (double)loops;
+	return 0;
+}
+
+/* reply to the request with the status and the formatted text */
+__attribute__((format(printf, 3, 4)))
+static inline
+void
+reply_text(
+	afb_req_t req,
+	int status,
+	const char *format,
+	...
+) {
+	int rc;
+	char *text;
+	va_list args;
+	afb_data_t reply;
+
+	va_start(args, format);
+	rc = vasprintf(&text, format, args);
+	va_end(args);
+	if (rc < 0 || afb_create_data_raw(&reply, AFB_PREDEFINED_TYPE_STRINGZ, text, 1 + (size_t)rc, free, text) < 0)
+		afb_req_reply(req, AFB_ERRNO_OUT_OF_MEMORY, 0, NULL);
+	else
+		afb_req_reply(req, status, 1, &reply);
+}